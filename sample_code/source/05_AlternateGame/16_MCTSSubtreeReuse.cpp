@@ -0,0 +1,1134 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <array>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+#include <queue>
+#include <set>
+#pragma GCC diagnostic ignored "-Wsign-compare"
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+constexpr const int H = 10;  // 미로의 높이
+constexpr const int W = 10;  // 미로의 너비
+constexpr int END_TURN = 50; // 게임 종료 턴
+
+using ScoreType = int64_t;
+constexpr const ScoreType INF = 1000000000LL;
+
+enum WinningStatus
+{
+    WIN,
+    LOSE,
+    DRAW,
+    NONE,
+};
+
+class AlternateMazeState
+{
+private:
+    static constexpr const int dx[4] = {1, -1, 0, 0};
+    static constexpr const int dy[4] = {0, 0, 1, -1};
+    struct Character
+    {
+        int y_;
+        int x_;
+        int game_score_;
+        Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+    };
+    std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+    int turn_;                             // 현재 턴
+    std::vector<Character> characters_;
+
+    // 현재 플레이어가 선공인지 판정한다.
+    bool isFirstPlayer() const
+    {
+        return this->turn_ % 2 == 0;
+    }
+
+public:
+    AlternateMazeState(const int seed) : points_(H, std::vector<int>(W)),
+                                         turn_(0),
+                                         characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+    {
+        auto mt_for_construct = std::mt19937(seed);
+
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                int point = mt_for_construct() % 10;
+                if (characters_[0].y_ == y && characters_[0].x_ == x)
+                {
+                    continue;
+                }
+                if (characters_[1].y_ == y && characters_[1].x_ == x)
+                {
+                    continue;
+                }
+
+                this->points_[y][x] = point;
+            }
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return this->turn_ == END_TURN;
+    }
+
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+    void advance(const int action)
+    {
+        auto &character = this->characters_[0];
+        character.x_ += dx[action];
+        character.y_ += dy[action];
+        auto &point = this->points_[character.y_][character.x_];
+        if (point > 0)
+        {
+            character.game_score_ += point;
+            point = 0;
+        }
+        this->turn_++;
+        std::swap(this->characters_[0], this->characters_[1]);
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        const auto &character = this->characters_[0];
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = character.y_ + dy[action];
+            int tx = character.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+            {
+                actions.emplace_back(action);
+            }
+        }
+        return actions;
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        if (isDone())
+        {
+            if (characters_[0].game_score_ > characters_[1].game_score_)
+                return WinningStatus::WIN;
+            else if (characters_[0].game_score_ < characters_[1].game_score_)
+                return WinningStatus::LOSE;
+            else
+                return WinningStatus::DRAW;
+        }
+        else
+        {
+            return WinningStatus::NONE;
+        }
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가한다.
+    ScoreType getScore() const
+    {
+        return characters_[0].game_score_ - characters_[1].game_score_;
+    }
+    // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가해서 0~1 값을 돌려준다.
+    double getScoreRate() const
+    {
+        if (characters_[0].game_score_ + characters_[1].game_score_ == 0)
+            return 0.;
+        return ((double)characters_[0].game_score_) / (double)(characters_[0].game_score_ + characters_[1].game_score_);
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+    double getFirstPlayerScoreForWinRate() const
+    {
+        switch (this->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            if (this->isFirstPlayer())
+            {
+                return 1.;
+            }
+            else
+            {
+                return 0.;
+            }
+        case (WinningStatus::LOSE):
+            if (this->isFirstPlayer())
+            {
+                return 0.;
+            }
+            else
+            {
+                return 1.;
+            }
+        default:
+            return 0.5;
+        }
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 같은 게임판인지 판정한다.
+    bool operator==(const AlternateMazeState &other) const
+    {
+        if (this->turn_ != other.turn_ || this->points_ != other.points_)
+        {
+            return false;
+        }
+        for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+        {
+            const auto &character = this->characters_[player_id];
+            const auto &other_character = other.characters_[player_id];
+            if (character.y_ != other_character.y_ || character.x_ != other_character.x_ || character.game_score_ != other_character.game_score_)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss("");
+        ss << "turn:\t" << this->turn_ << "\n";
+        for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+        {
+            int actual_player_id = player_id;
+            if (this->turn_ % 2 == 1)
+            {
+                actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+            }
+            const auto &chara = this->characters_[actual_player_id];
+            ss << "score(" << player_id << "):\t" << chara.game_score_ << "\ty: " << chara.y_ << " x: " << chara.x_ << "\n";
+        }
+        for (int h = 0; h < H; h++)
+        {
+            for (int w = 0; w < W; w++)
+            {
+                bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                {
+                    int actual_player_id = player_id;
+                    if (this->turn_ % 2 == 1)
+                    {
+                        actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                    }
+
+                    const auto &character = this->characters_[player_id];
+                    if (character.y_ == h && character.x_ == w)
+                    {
+                        if (actual_player_id == 0)
+                        {
+                            ss << 'A';
+                        }
+                        else
+                        {
+                            ss << 'B';
+                        }
+                        is_written = true;
+                    }
+                }
+                if (!is_written)
+                {
+                    if (this->points_[h][w] > 0)
+                    {
+                        ss << points_[h][w];
+                    }
+                    else
+                    {
+                        ss << '.';
+                    }
+                }
+            }
+            ss << '\n';
+        }
+
+        return ss.str();
+    }
+};
+
+using State = AlternateMazeState;
+
+// 무작위로 행동을 결정한다.
+int randomAction(const State &state)
+{
+    auto legal_actions = state.legalActions();
+    return legal_actions[mt_for_action() % (legal_actions.size())];
+}
+namespace montecarlo
+{
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(State *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state));
+            return 1. - playout(state);
+        }
+    }
+    // 플레이아웃 횟수를 지정해서 순수 몬테카를로 탐색으로 행동을 결정한다.
+    int primitiveMontecarloAction(const State &state, int playout_number)
+    {
+        auto legal_actions = state.legalActions();
+        auto values = std::vector<double>(legal_actions.size());
+        auto cnts = std::vector<double>(legal_actions.size());
+        for (int cnt = 0; cnt < playout_number; cnt++)
+        {
+            int index = cnt % legal_actions.size();
+
+            State next_state = state;
+            next_state.advance(legal_actions[index]);
+            values[index] += 1. - playout(&next_state);
+            ++cnts[index];
+        }
+        int best_action_index = -1;
+        double best_score = -INF;
+        for (int index = 0; index < legal_actions.size(); index++)
+        {
+            double value_mean = values[index] / cnts[index];
+            if (value_mean > best_score)
+            {
+                best_score = value_mean;
+                best_action_index = index;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+
+    constexpr const double C = 1.;             // UCB1 계산에 사용하는 상수
+    constexpr const int EXPAND_THRESHOLD = 10; // 노드를 확장하는 임계치
+
+    // MCTS 계산에 사용하는 노드
+    class Node
+    {
+    private:
+        State state_;
+        double w_;
+
+    public:
+        std::vector<Node> child_nodes_;
+        double n_;
+
+        Node(const State &state) : state_(state), w_(0), n_(0) {}
+
+        // 노드를 평가한다.
+        double evaluate()
+        {
+            if (this->state_.isDone())
+            {
+                double value = 0.5;
+                switch (this->state_.getWinningStatus())
+                {
+                case (WinningStatus::WIN):
+                    value = 1.;
+                    break;
+                case (WinningStatus::LOSE):
+                    value = 0.;
+                    break;
+                default:
+                    break;
+                }
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+            if (this->child_nodes_.empty())
+            {
+                State state_copy = this->state_;
+                double value = playout(&state_copy);
+                this->w_ += value;
+                ++this->n_;
+
+                if (this->n_ == EXPAND_THRESHOLD)
+                    this->expand();
+
+                return value;
+            }
+            else
+            {
+                double value = 1. - this->nextChildNode().evaluate();
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+        }
+
+        // 노드를 확장한다.
+        void expand()
+        {
+            auto legal_actions = this->state_.legalActions();
+            this->child_nodes_.clear();
+            for (const auto action : legal_actions)
+            {
+                this->child_nodes_.emplace_back(this->state_);
+                this->child_nodes_.back().state_.advance(action);
+            }
+        }
+
+        // 어떤 노드를 평가할지 선택한다.
+        Node &nextChildNode()
+        {
+            for (auto &child_node : this->child_nodes_)
+            {
+                if (child_node.n_ == 0)
+                    return child_node;
+            }
+            double t = 0;
+            for (const auto &child_node : this->child_nodes_)
+            {
+                t += child_node.n_;
+            }
+            double best_value = -INF;
+            int best_action_index = -1;
+            for (int i = 0; i < this->child_nodes_.size(); i++)
+            {
+                const auto &child_node = this->child_nodes_[i];
+                double ucb1_value = 1. - child_node.w_ / child_node.n_ + (double)C * std::sqrt(2. * std::log(t) / child_node.n_);
+                if (ucb1_value > best_value)
+                {
+                    best_action_index = i;
+                    best_value = ucb1_value;
+                }
+            }
+            return this->child_nodes_[best_action_index];
+        }
+    };
+
+    // 플레이아웃 횟수를 지정해서 MCTS로 행동을 결정한다.
+    int mctsAction(const State &state, const int playout_number)
+    {
+        Node root_node = Node(state);
+        root_node.expand();
+        for (int i = 0; i < playout_number; i++)
+        {
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes_.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes_[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+
+    // 제한 시간(밀리초)을 지정해서 MCTS로 행동을 결정한다.
+    int mctsActionWithTimeThreshold(const State &state, const int64_t time_threshold)
+    {
+        Node root_node = Node(state);
+        root_node.expand();
+        auto time_keeper = TimeKeeper(time_threshold);
+        for (int cnt = 0;; cnt++)
+        {
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes_.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes_[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+}
+
+using montecarlo::mctsAction;
+using montecarlo::mctsActionWithTimeThreshold;
+using montecarlo::primitiveMontecarloAction;
+
+namespace thunder
+{
+
+    // Thunder 탐색 계산에서 사용하는 노드
+    class Node
+    {
+    private:
+        State state_;
+        double w_;
+
+    public:
+        std::vector<Node> child_nodes_;
+        double n_;
+
+        Node(const State &state) : state_(state), w_(0), n_(0) {}
+
+        // 노드를 평가한다.
+        double evaluate()
+        {
+            if (this->state_.isDone())
+            {
+                double value = 0.5;
+                switch (this->state_.getWinningStatus())
+                {
+                case (WinningStatus::WIN):
+                    value = 1.;
+                    break;
+                case (WinningStatus::LOSE):
+                    value = 0.;
+                    break;
+                default:
+                    break;
+                }
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+            if (this->child_nodes_.empty())
+            {
+                double value = this->state_.getScoreRate();
+                this->w_ += value;
+                ++this->n_;
+
+                this->expand();
+
+                return value;
+            }
+            else
+            {
+                double value = 1. - this->nextChildNode().evaluate();
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+        }
+
+        // 노드를 확장한다.
+        void expand()
+        {
+            auto legal_actions = this->state_.legalActions();
+            this->child_nodes_.clear();
+            for (const auto action : legal_actions)
+            {
+                this->child_nodes_.emplace_back(this->state_);
+                this->child_nodes_.back().state_.advance(action);
+            }
+        }
+
+        // 어떤 노드를 평가할지 선택한다.
+        Node &nextChildNode()
+        {
+            for (auto &child_node : this->child_nodes_)
+            {
+                if (child_node.n_ == 0)
+                    return child_node;
+            }
+            double t = 0;
+            for (const auto &child_node : this->child_nodes_)
+            {
+                t += child_node.n_;
+            }
+            double best_value = -INF;
+            int best_action_index = -1;
+            for (int i = 0; i < this->child_nodes_.size(); i++)
+            {
+                const auto &child_node = this->child_nodes_[i];
+
+                double thunder_value = 1. - child_node.w_ / child_node.n_;
+                if (thunder_value > best_value)
+                {
+                    best_action_index = i;
+                    best_value = thunder_value;
+                }
+            }
+            return this->child_nodes_[best_action_index];
+        }
+    };
+
+    // 탐색 횟수를 지정해서 Thunder 탐색으로 행동을 결정한다.
+    int thunderSearchAction(const State &state, const int playout_number)
+    {
+        Node root_node = Node(state);
+        root_node.expand();
+        for (int i = 0; i < playout_number; i++)
+        {
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes_.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes_[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+
+    // 제한 시간(밀리초)을 지정해서 Thunder 탐색으로 행동을 결정한다.
+    int thunderSearchActionWithTimeThreshold(const State &state, const int64_t time_threshold)
+    {
+        Node root_node = Node(state);
+        root_node.expand();
+        auto time_keeper = TimeKeeper(time_threshold);
+        for (int cnt = 0;; cnt++)
+        {
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes_.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes_[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+
+}
+using thunder::thunderSearchAction;
+using thunder::thunderSearchActionWithTimeThreshold;
+
+// 탐색 트리의 모든 노드를 하나의 배열 묶음에 모아서 인덱스로 관리한다.
+// 노드별 통계값은 항목별 배열(SoA)로 나누어 두고, 자식 노드는 연속된 인덱스에 배치한다.
+// 자식 노드를 선택할 때는 연속된 n_, w_ 구간만 읽으므로 힙에 흩어진 노드를 따라가지 않는다.
+template <class NodeState>
+class NodeArena
+{
+public:
+    std::vector<NodeState> states_; // 노드의 게임판
+    std::vector<int> n_;            // 시행 횟수
+    std::vector<float> w_;          // 누적 가치
+    std::vector<int> first_child_;  // 첫 번째 자식 노드의 인덱스(미확장이면 -1)
+    std::vector<int> child_count_;  // 자식 노드 수
+
+    NodeArena(NodeState state, const int reserve_size = 1 << 12)
+    {
+        this->states_.reserve(reserve_size);
+        this->n_.reserve(reserve_size);
+        this->w_.reserve(reserve_size);
+        this->first_child_.reserve(reserve_size);
+        this->child_count_.reserve(reserve_size);
+        this->addNode(std::move(state));
+    }
+
+    int size() const
+    {
+        return this->n_.size();
+    }
+
+    // 노드를 추가하고 인덱스를 돌려준다.
+    int addNode(NodeState state)
+    {
+        this->states_.emplace_back(std::move(state));
+        this->n_.emplace_back(0);
+        this->w_.emplace_back(0.f);
+        this->first_child_.emplace_back(-1);
+        this->child_count_.emplace_back(0);
+        return this->size() - 1;
+    }
+
+    // 노드를 확장한다. 자식 노드는 배열 끝에 연속으로 추가된다.
+    void expand(const int node)
+    {
+        auto legal_actions = this->states_[node].legalActions();
+        if (this->states_.capacity() < this->size() + legal_actions.size())
+        { // 부모 노드의 게임판을 참조하는 동안 재할당이 일어나지 않도록 미리 늘려둔다.
+            this->states_.reserve(2 * (this->size() + legal_actions.size()));
+        }
+        const int first_child = this->size();
+        for (const auto action : legal_actions)
+        {
+            this->addNode(this->states_[node]);
+            this->states_.back().advance(action);
+        }
+        this->first_child_[node] = first_child;
+        this->child_count_[node] = legal_actions.size();
+    }
+
+    // 노드에 평가 결과를 반영한다.
+    void update(const int node, const double value)
+    {
+        this->w_[node] += value;
+        ++this->n_[node];
+    }
+
+    // node를 루트로 하는 부분 트리만 남기고 나머지 노드를 해제한다.
+    // 너비 우선 순서로 다시 배치하므로 자식 노드는 계속 연속된 인덱스에 위치한다.
+    // 이어지는 탐색에서 트리가 다시 커지므로 배열은 기존 크기만큼 확보해 둔다.
+    void reroot(const int node)
+    {
+        auto subtree = NodeArena<NodeState>(std::move(this->states_[node]), this->size());
+        subtree.n_[0] = this->n_[node];
+        subtree.w_[0] = this->w_[node];
+        std::vector<int> old_indexes = {node}; // 새 인덱스 순서대로 나열한 기존 인덱스
+        for (int new_node = 0; new_node < old_indexes.size(); new_node++)
+        {
+            const int old_node = old_indexes[new_node];
+            const int first_child = this->first_child_[old_node];
+            if (this->child_count_[old_node] == 0)
+            {
+                continue;
+            }
+            subtree.first_child_[new_node] = subtree.size();
+            subtree.child_count_[new_node] = this->child_count_[old_node];
+            for (int i = first_child; i < first_child + this->child_count_[old_node]; i++)
+            {
+                int new_child = subtree.addNode(std::move(this->states_[i]));
+                subtree.n_[new_child] = this->n_[i];
+                subtree.w_[new_child] = this->w_[i];
+                old_indexes.emplace_back(i);
+            }
+        }
+        *this = std::move(subtree);
+    }
+
+    // 가장 많이 시행한 자식 노드가 몇 번째 자식인지 돌려준다.
+    int mostVisitedChildOrder(const int node) const
+    {
+        const int first_child = this->first_child_[node];
+        int best_searched_number = -1;
+        int best_order = -1;
+        for (int i = 0; i < this->child_count_[node]; i++)
+        {
+            int n = this->n_[first_child + i];
+            if (n > best_searched_number)
+            {
+                best_order = i;
+                best_searched_number = n;
+            }
+        }
+        return best_order;
+    }
+};
+
+// 게임 종료시의 가치를 계산한다.
+template <class NodeState>
+double terminalValue(const NodeState &state)
+{
+    switch (state.getWinningStatus())
+    {
+    case (WinningStatus::WIN):
+        return 1.;
+    case (WinningStatus::LOSE):
+        return 0.;
+    default:
+        return 0.5;
+    }
+}
+
+namespace arena_montecarlo
+{
+    using montecarlo::C;
+    using montecarlo::EXPAND_THRESHOLD;
+    using montecarlo::playout;
+
+    // 어떤 노드를 평가할지 선택한다.
+    int nextChildNode(const NodeArena<State> &arena, const int node)
+    {
+        const int first_child = arena.first_child_[node];
+        const int last_child = first_child + arena.child_count_[node];
+        const int *n = arena.n_.data();
+        const float *w = arena.w_.data();
+        int t = 0;
+        for (int i = first_child; i < last_child; i++)
+        {
+            if (n[i] == 0)
+                return i;
+            t += n[i];
+        }
+        const double log_t = std::log((double)t);
+        double best_value = -INF;
+        int best_node = -1;
+        for (int i = first_child; i < last_child; i++)
+        {
+            double ucb1_value = 1. - w[i] / n[i] + C * std::sqrt(2. * log_t / n[i]);
+            if (ucb1_value > best_value)
+            {
+                best_node = i;
+                best_value = ucb1_value;
+            }
+        }
+        return best_node;
+    }
+
+    // 노드를 평가한다.
+    double evaluate(NodeArena<State> &arena, const int node)
+    {
+        // 게임 종료시
+        if (arena.states_[node].isDone())
+        {
+            double value = terminalValue(arena.states_[node]);
+            arena.update(node, value);
+            return value;
+        }
+        // 자식 노드가 존재하지 않는 경우
+        if (arena.child_count_[node] == 0)
+        {
+            State state_copy = arena.states_[node];
+            double value = playout(&state_copy);
+            arena.update(node, value);
+
+            if (arena.n_[node] == EXPAND_THRESHOLD)
+                arena.expand(node);
+
+            return value;
+        }
+        // 자식 노드가 존재하는 경우
+        else
+        {
+            double value = 1. - evaluate(arena, nextChildNode(arena, node));
+            arena.update(node, value);
+            return value;
+        }
+    }
+
+    // 제한 시간(밀리초)을 지정해서 노드 아레나를 사용한 MCTS로 행동을 결정한다.
+    int mctsActionWithTimeThreshold(const State &state, const int64_t time_threshold)
+    {
+        auto arena = NodeArena<State>(state);
+        arena.expand(0);
+        auto time_keeper = TimeKeeper(time_threshold);
+        while (!time_keeper.isTimeOver())
+        {
+            evaluate(arena, 0);
+        }
+        auto legal_actions = state.legalActions();
+        assert(legal_actions.size() == arena.child_count_[0]);
+        return legal_actions[arena.mostVisitedChildOrder(0)];
+    }
+}
+
+namespace arena_thunder
+{
+    // 어떤 노드를 평가할지 선택한다.
+    int nextChildNode(const NodeArena<State> &arena, const int node)
+    {
+        const int first_child = arena.first_child_[node];
+        const int last_child = first_child + arena.child_count_[node];
+        const int *n = arena.n_.data();
+        const float *w = arena.w_.data();
+        for (int i = first_child; i < last_child; i++)
+        {
+            if (n[i] == 0)
+                return i;
+        }
+        double best_value = -INF;
+        int best_node = -1;
+        for (int i = first_child; i < last_child; i++)
+        {
+            double thunder_value = 1. - w[i] / n[i];
+            if (thunder_value > best_value)
+            {
+                best_node = i;
+                best_value = thunder_value;
+            }
+        }
+        return best_node;
+    }
+
+    // 노드를 평가한다.
+    double evaluate(NodeArena<State> &arena, const int node)
+    {
+        if (arena.states_[node].isDone())
+        {
+            double value = terminalValue(arena.states_[node]);
+            arena.update(node, value);
+            return value;
+        }
+        if (arena.child_count_[node] == 0)
+        {
+            double value = arena.states_[node].getScoreRate();
+            arena.update(node, value);
+            arena.expand(node);
+            return value;
+        }
+        else
+        {
+            double value = 1. - evaluate(arena, nextChildNode(arena, node));
+            arena.update(node, value);
+            return value;
+        }
+    }
+
+    // 제한 시간(밀리초)을 지정해서 노드 아레나를 사용한 Thunder 탐색으로 행동을 결정한다.
+    int thunderSearchActionWithTimeThreshold(const State &state, const int64_t time_threshold)
+    {
+        auto arena = NodeArena<State>(state);
+        arena.expand(0);
+        auto time_keeper = TimeKeeper(time_threshold);
+        while (!time_keeper.isTimeOver())
+        {
+            evaluate(arena, 0);
+        }
+        auto legal_actions = state.legalActions();
+        assert(legal_actions.size() == arena.child_count_[0]);
+        return legal_actions[arena.mostVisitedChildOrder(0)];
+    }
+}
+
+namespace reuse
+{
+    // 실제로 둔 행동에 맞춰 루트를 옮기면서 턴을 넘어 탐색 트리를 이어서 사용한다.
+    // Evaluate에는 arena_montecarlo::evaluate나 arena_thunder::evaluate를 지정한다.
+    template <double (*Evaluate)(NodeArena<State> &, const int)>
+    class ReusableTreeSearch
+    {
+    private:
+        static constexpr const int REUSE_DEPTH = 2; // 자신의 행동과 상대방의 응수만큼 내려가서 일치하는 노드를 찾는다.
+
+        NodeArena<State> arena_;
+
+        // node 아래 depth 단계 이내에서 state와 같은 게임판의 노드를 찾는다. 없으면 -1을 돌려준다.
+        int findNode(const int node, const State &state, const int depth) const
+        {
+            if (this->arena_.states_[node] == state)
+            {
+                return node;
+            }
+            if (depth == 0)
+            {
+                return -1;
+            }
+            const int first_child = this->arena_.first_child_[node];
+            for (int i = 0; i < this->arena_.child_count_[node]; i++)
+            {
+                int found = this->findNode(first_child + i, state, depth - 1);
+                if (found >= 0)
+                {
+                    return found;
+                }
+            }
+            return -1;
+        }
+
+    public:
+        int64_t decision_number_ = 0;  // 행동을 결정한 횟수
+        int64_t reused_number_ = 0;    // 이전 탐색 트리를 이어서 사용한 횟수
+        int64_t reused_visits_ = 0;    // 탐색 시작 시점에 루트가 이미 가지고 있던 시행 횟수의 합
+        int64_t effective_visits_ = 0; // 행동 결정 시점의 루트 시행 횟수의 합
+
+        ReusableTreeSearch() : arena_(State(0)) {}
+
+        // 제한 시간(밀리초)을 지정해서 탐색하고 행동을 결정한다.
+        int searchAction(const State &state, const int64_t time_threshold)
+        {
+            auto time_keeper = TimeKeeper(time_threshold);
+            int node = this->findNode(0, state, REUSE_DEPTH);
+            if (node < 0)
+            { // 새 게임이거나 트리에 없는 게임판이면 처음부터 탐색한다.
+                this->arena_ = NodeArena<State>(state);
+            }
+            else
+            {
+                this->arena_.reroot(node);
+                ++this->reused_number_;
+                this->reused_visits_ += this->arena_.n_[0];
+            }
+            if (this->arena_.child_count_[0] == 0)
+            {
+                this->arena_.expand(0);
+            }
+            while (!time_keeper.isTimeOver())
+            {
+                Evaluate(this->arena_, 0);
+            }
+            ++this->decision_number_;
+            this->effective_visits_ += this->arena_.n_[0];
+
+            auto legal_actions = state.legalActions();
+            assert(legal_actions.size() == this->arena_.child_count_[0]);
+            return legal_actions[this->arena_.mostVisitedChildOrder(0)];
+        }
+
+        // 탐색 통계를 표시한다.
+        void printStatistics(const std::string &name) const
+        {
+            using std::cout;
+            using std::endl;
+            cout << name << ":\treused " << this->reused_number_ << " / " << this->decision_number_ << " decisions"
+                 << ", reused visits " << (double)this->reused_visits_ / this->decision_number_
+                 << ", effective visits " << (double)this->effective_visits_ / this->decision_number_ << " per decision" << endl;
+        }
+    };
+
+    // 이전 탐색 결과를 버리는 탐색의 루트 시행 횟수를 세기 위한 비교용 탐색
+    template <double (*Evaluate)(NodeArena<State> &, const int)>
+    class FreshTreeSearch
+    {
+    public:
+        int64_t decision_number_ = 0;  // 행동을 결정한 횟수
+        int64_t effective_visits_ = 0; // 행동 결정 시점의 루트 시행 횟수의 합
+
+        // 제한 시간(밀리초)을 지정해서 탐색하고 행동을 결정한다.
+        int searchAction(const State &state, const int64_t time_threshold)
+        {
+            auto time_keeper = TimeKeeper(time_threshold);
+            auto arena = NodeArena<State>(state);
+            arena.expand(0);
+            while (!time_keeper.isTimeOver())
+            {
+                Evaluate(arena, 0);
+            }
+            ++this->decision_number_;
+            this->effective_visits_ += arena.n_[0];
+
+            auto legal_actions = state.legalActions();
+            assert(legal_actions.size() == arena.child_count_[0]);
+            return legal_actions[arena.mostVisitedChildOrder(0)];
+        }
+
+        // 탐색 통계를 표시한다.
+        void printStatistics(const std::string &name) const
+        {
+            using std::cout;
+            using std::endl;
+            cout << name << ":\teffective visits " << (double)this->effective_visits_ / this->decision_number_ << " per decision" << endl;
+        }
+    };
+
+    using ReusableMCTS = ReusableTreeSearch<arena_montecarlo::evaluate>;
+    using ReusableThunderSearch = ReusableTreeSearch<arena_thunder::evaluate>;
+    using FreshMCTS = FreshTreeSearch<arena_montecarlo::evaluate>;
+    using FreshThunderSearch = FreshTreeSearch<arena_thunder::evaluate>;
+}
+
+using AIFunction = std::function<int(const State &)>;
+using StringAIPair = std::pair<std::string, AIFunction>;
+
+// 게임을 game_number×2(선공과 후공을 교대)횟수만큼 플레이해서 ais의 0번째에 있는 AI 승률을 표시한다.
+void testFirstPlayerWinRate(const std::array<StringAIPair, 2> &ais, const int game_number)
+{
+    using std::cout;
+    using std::endl;
+
+    double first_player_win_rate = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto base_state = State(i);
+        for (int j = 0; j < 2; j++)
+        { // 공평하게 선공과 후공을 교대함
+            auto state = base_state;
+            auto &first_ai = ais[j];
+            auto &second_ai = ais[(j + 1) % 2];
+            while (true)
+            {
+                state.advance(first_ai.second(state));
+                if (state.isDone())
+                    break;
+                state.advance(second_ai.second(state));
+                if (state.isDone())
+                    break;
+            }
+            double win_rate_point = state.getFirstPlayerScoreForWinRate();
+            if (j == 1)
+                win_rate_point = 1 - win_rate_point;
+            if (win_rate_point >= 0)
+            {
+                state.toString();
+            }
+            first_player_win_rate += win_rate_point;
+        }
+        cout << "i " << i << " w " << first_player_win_rate / ((i + 1) * 2) << endl;
+    }
+    first_player_win_rate /= (double)(game_number * 2);
+    cout << "Winning rate of " << ais[0].first << " to " << ais[1].first << ":\t" << first_player_win_rate << endl;
+}
+
+int main()
+{
+    using std::cout;
+    using std::endl;
+    {
+        auto reusable_mcts = reuse::ReusableMCTS();
+        auto fresh_mcts = reuse::FreshMCTS();
+        auto ais = std::array<StringAIPair, 2>{
+            StringAIPair("ReusableMCTS 1ms", [&reusable_mcts](const State &state)
+                         { return reusable_mcts.searchAction(state, 1); }),
+            StringAIPair("FreshMCTS 1ms", [&fresh_mcts](const State &state)
+                         { return fresh_mcts.searchAction(state, 1); }),
+        };
+        testFirstPlayerWinRate(ais, 100);
+        reusable_mcts.printStatistics("ReusableMCTS");
+        fresh_mcts.printStatistics("FreshMCTS");
+    }
+    {
+        auto reusable_thunder = reuse::ReusableThunderSearch();
+        auto fresh_thunder = reuse::FreshThunderSearch();
+        auto ais = std::array<StringAIPair, 2>{
+            StringAIPair("ReusableThunderSearch 1ms", [&reusable_thunder](const State &state)
+                         { return reusable_thunder.searchAction(state, 1); }),
+            StringAIPair("FreshThunderSearch 1ms", [&fresh_thunder](const State &state)
+                         { return fresh_thunder.searchAction(state, 1); }),
+        };
+        testFirstPlayerWinRate(ais, 100);
+        reusable_thunder.printStatistics("ReusableThunderSearch");
+        fresh_thunder.printStatistics("FreshThunderSearch");
+    }
+    return 0;
+}
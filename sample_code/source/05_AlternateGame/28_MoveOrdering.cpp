@@ -0,0 +1,944 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <array>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+#include <queue>
+#include <set>
+#include <limits>
+#pragma GCC diagnostic ignored "-Wsign-compare"
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+constexpr const int H = 5;   // 미로의 높이
+constexpr const int W = 5;   // 미로의 너비
+constexpr int END_TURN = 10; // 게임 종료 턴
+
+using ScoreType = int64_t;
+constexpr const ScoreType INF = 1000000000LL;
+
+enum WinningStatus
+{
+    WIN,
+    LOSE,
+    DRAW,
+    NONE,
+};
+
+namespace zobrist_hash
+{
+    std::mt19937_64 mt_init_hash(0);
+    constexpr const int MAX_GAME_SCORE = 9 * END_TURN; // 한 플레이어가 얻을 수 있는 최대 점수
+
+    uint64_t points[H][W][9 + 1] = {}; // 숫자 그대로 이용할 수 있도록 1을 더함
+    uint64_t character[2][H][W] = {};  // [선공, 후공][y][x]
+    uint64_t game_score[2][MAX_GAME_SCORE + 1] = {};
+    uint64_t turn[END_TURN + 1] = {};
+    void init()
+    {
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                for (int p = 1; p < 9 + 1; p++)
+                {
+                    points[y][x][p] = mt_init_hash();
+                }
+                for (int player_id = 0; player_id < 2; player_id++)
+                {
+                    character[player_id][y][x] = mt_init_hash();
+                }
+            }
+        for (int player_id = 0; player_id < 2; player_id++)
+        {
+            for (int score = 0; score <= MAX_GAME_SCORE; score++)
+            {
+                game_score[player_id][score] = mt_init_hash();
+            }
+        }
+        for (int t = 0; t <= END_TURN; t++)
+        {
+            turn[t] = mt_init_hash();
+        }
+    }
+}
+
+class AlternateMazeState
+{
+private:
+    static constexpr const int dx[4] = {1, -1, 0, 0};
+    static constexpr const int dy[4] = {0, 0, 1, -1};
+    struct Character
+    {
+        int y_;
+        int x_;
+        int game_score_;
+        Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+    };
+    std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+    int turn_;                             // 현재 턴
+    std::vector<Character> characters_;
+
+    // 현재 플레이어가 선공인지 판정한다.
+    bool isFirstPlayer() const
+    {
+        return this->turn_ % 2 == 0;
+    }
+
+    //  zobrist_hash용
+    // characters_[0]은 항상 현재 플레이어이므로, 해시는 선공과 후공을 구별하는 플레이어 번호로 계산한다.
+    void init_hash()
+    {
+        hash_ = zobrist_hash::turn[this->turn_];
+        for (int i = 0; i < 2; i++)
+        {
+            const int player_id = (this->turn_ + i) % 2;
+            const auto &character = this->characters_[i];
+            hash_ ^= zobrist_hash::character[player_id][character.y_][character.x_];
+            hash_ ^= zobrist_hash::game_score[player_id][character.game_score_];
+        }
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                auto point = points_[y][x];
+                if (point > 0)
+                {
+                    hash_ ^= zobrist_hash::points[y][x][point];
+                }
+            }
+    }
+
+public:
+    uint64_t hash_ = 0; // 동일 게임판 판정에 사용하는 해시
+
+    AlternateMazeState(const int seed) : points_(H, std::vector<int>(W)),
+                                         turn_(0),
+                                         characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+    {
+        auto mt_for_construct = std::mt19937(seed);
+
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                int point = mt_for_construct() % 10;
+                if (characters_[0].y_ == y && characters_[0].x_ == x)
+                {
+                    continue;
+                }
+                if (characters_[1].y_ == y && characters_[1].x_ == x)
+                {
+                    continue;
+                }
+
+                this->points_[y][x] = point;
+            }
+        this->init_hash();
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return this->turn_ == END_TURN;
+    }
+
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+    void advance(const int action)
+    {
+        const int player_id = this->turn_ % 2;
+        auto &character = this->characters_[0];
+        hash_ ^= zobrist_hash::character[player_id][character.y_][character.x_]; // 현재 캐릭터 위치 정보를 제거
+        character.x_ += dx[action];
+        character.y_ += dy[action];
+        hash_ ^= zobrist_hash::character[player_id][character.y_][character.x_]; // 이동할 캐릭터 위치 정보를 추가
+        auto &point = this->points_[character.y_][character.x_];
+        if (point > 0)
+        {
+            hash_ ^= zobrist_hash::points[character.y_][character.x_][point]; // 점수가 없어진 것을 해시에 반영
+            hash_ ^= zobrist_hash::game_score[player_id][character.game_score_];
+            character.game_score_ += point;
+            hash_ ^= zobrist_hash::game_score[player_id][character.game_score_];
+            point = 0;
+        }
+        hash_ ^= zobrist_hash::turn[this->turn_];
+        this->turn_++;
+        hash_ ^= zobrist_hash::turn[this->turn_];
+        std::swap(this->characters_[0], this->characters_[1]);
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        const auto &character = this->characters_[0];
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = character.y_ + dy[action];
+            int tx = character.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+            {
+                actions.emplace_back(action);
+            }
+        }
+        return actions;
+    }
+
+    // [수 순서 정렬] : action을 둔 결과 도착하는 칸의 번호를 돌려준다.
+    int moveKey(const int action) const
+    {
+        const auto &character = this->characters_[0];
+        return (character.y_ + dy[action]) * W + (character.x_ + dx[action]);
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        if (isDone())
+        {
+            if (characters_[0].game_score_ > characters_[1].game_score_)
+                return WinningStatus::WIN;
+            else if (characters_[0].game_score_ < characters_[1].game_score_)
+                return WinningStatus::LOSE;
+            else
+                return WinningStatus::DRAW;
+        }
+        else
+        {
+            return WinningStatus::NONE;
+        }
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가한다.
+    ScoreType getScore() const
+    {
+        return characters_[0].game_score_ - characters_[1].game_score_;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+    double getFirstPlayerScoreForWinRate() const
+    {
+        switch (this->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            if (this->isFirstPlayer())
+            {
+                return 1.;
+            }
+            else
+            {
+                return 0.;
+            }
+        case (WinningStatus::LOSE):
+            if (this->isFirstPlayer())
+            {
+                return 0.;
+            }
+            else
+            {
+                return 1.;
+            }
+        default:
+            return 0.5;
+        }
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss("");
+        ss << "turn:\t" << this->turn_ << "\n";
+        for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+        {
+            int actual_player_id = player_id;
+            if (this->turn_ % 2 == 1)
+            {
+                actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+            }
+            const auto &chara = this->characters_[actual_player_id];
+            ss << "score(" << player_id << "):\t" << chara.game_score_ << "\ty: " << chara.y_ << " x: " << chara.x_ << "\n";
+        }
+        for (int h = 0; h < H; h++)
+        {
+            for (int w = 0; w < W; w++)
+            {
+                bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                {
+                    int actual_player_id = player_id;
+                    if (this->turn_ % 2 == 1)
+                    {
+                        actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                    }
+
+                    const auto &character = this->characters_[player_id];
+                    if (character.y_ == h && character.x_ == w)
+                    {
+                        if (actual_player_id == 0)
+                        {
+                            ss << 'A';
+                        }
+                        else
+                        {
+                            ss << 'B';
+                        }
+                        is_written = true;
+                    }
+                }
+                if (!is_written)
+                {
+                    if (this->points_[h][w] > 0)
+                    {
+                        ss << points_[h][w];
+                    }
+                    else
+                    {
+                        ss << '.';
+                    }
+                }
+            }
+            ss << '\n';
+        }
+
+        return ss.str();
+    }
+};
+
+using State = AlternateMazeState;
+
+namespace iterativedeepening
+{
+    int64_t node_number = 0; // alphaBetaScore를 호출한 횟수
+
+    // 제한 시간이 넘으면 정지하는 알파-베타 가지치기용 점수 계산
+    ScoreType alphaBetaScore(const State &state, ScoreType alpha, const ScoreType beta, const int depth, const TimeKeeper &time_keeper)
+    {
+        ++node_number;
+        if (time_keeper.isTimeOver())
+            return 0;
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        auto legal_actions = state.legalActions();
+        if (legal_actions.empty())
+        {
+            return state.getScore();
+        }
+        for (const auto action : legal_actions)
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -beta, -alpha, depth - 1, time_keeper);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                alpha = score;
+            }
+            if (alpha >= beta)
+            {
+                return alpha;
+            }
+        }
+        return alpha;
+    }
+    // 깊이와 제한 시간(밀리초)을 지정해서 알파-베타 가지치기로 행동을 결정한다.
+    int alphaBetaActionWithTimeThreshold(const State &state, const int depth, const TimeKeeper &time_keeper)
+    {
+        ScoreType best_action = -1;
+        ScoreType alpha = -INF;
+        for (const auto action : state.legalActions())
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -INF, -alpha, depth, time_keeper);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                best_action = action;
+                alpha = score;
+            }
+        }
+        return best_action;
+    }
+
+    // 제한 시간(밀리초)을 지정해서 반복 심화 탐색으로 행동을 결정한다.
+    int iterativeDeepeningAction(const State &state, const int64_t time_threshold)
+    {
+        auto time_keeper = TimeKeeper(time_threshold);
+        int best_action = -1;
+        for (int depth = 1;; depth++)
+        {
+            int action = alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            else
+            {
+                best_action = action;
+            }
+        }
+        return best_action;
+    }
+}
+using iterativedeepening::iterativeDeepeningAction;
+
+namespace transposition
+{
+    // 저장한 점수가 실제 점수와 어떤 관계인지 나타낸다.
+    enum class Bound : uint8_t
+    {
+        EXACT, // 실제 점수
+        LOWER, // 실제 점수의 하한(beta 이상으로 가지치기함)
+        UPPER, // 실제 점수의 상한(alpha를 넘는 행동이 없었음)
+    };
+
+    struct Entry
+    {
+        uint64_t hash_ = 0;
+        ScoreType score_ = 0;
+        int16_t depth_ = -1; // 남은 탐색 깊이(-1이면 빈 칸)
+        int8_t best_action_ = -1;
+        Bound bound_ = Bound::EXACT;
+        uint16_t generation_ = 0; // 저장한 탐색의 세대
+    };
+
+    // 해시의 하위 비트로 칸을 정하는 고정 크기 치환표
+    // 반복 심화의 반복 사이와 턴 사이에서 같은 표를 계속 사용한다.
+    class TranspositionTable
+    {
+    private:
+        std::vector<Entry> entries_;
+        uint64_t mask_;
+        uint16_t generation_ = 0;
+
+    public:
+        int64_t probe_number_ = 0; // 조회한 횟수
+        int64_t hit_number_ = 0;   // 같은 게임판이 저장되어 있었던 횟수
+
+        // 2의 거듭제곱 개의 칸을 가진 표를 만든다.
+        TranspositionTable(const int log2_size = 16) : entries_(1ULL << log2_size), mask_((1ULL << log2_size) - 1) {}
+
+        // 새 탐색(행동 결정)을 시작한다. 이전 세대의 칸은 깊이에 관계없이 덮어쓸 수 있다.
+        void newSearch()
+        {
+            ++this->generation_;
+        }
+
+        // 같은 게임판의 칸이 있으면 돌려주고, 없으면 nullptr을 돌려준다.
+        const Entry *probe(const uint64_t hash)
+        {
+            ++this->probe_number_;
+            const auto &entry = this->entries_[hash & this->mask_];
+            if (entry.depth_ < 0 || entry.hash_ != hash)
+            {
+                return nullptr;
+            }
+            ++this->hit_number_;
+            return &entry;
+        }
+
+        // 탐색 결과를 저장한다. 같은 세대의 더 깊은 결과는 얕은 결과로 덮어쓰지 않는다.
+        void store(const uint64_t hash, const int depth, const Bound bound, const ScoreType score, const int best_action)
+        {
+            auto &entry = this->entries_[hash & this->mask_];
+            if (entry.hash_ != hash && entry.generation_ == this->generation_ && entry.depth_ > depth)
+            {
+                return;
+            }
+            if (entry.hash_ == hash && entry.depth_ > depth)
+            {
+                return;
+            }
+            entry.hash_ = hash;
+            entry.score_ = score;
+            entry.depth_ = depth;
+            entry.best_action_ = best_action;
+            entry.bound_ = bound;
+            entry.generation_ = this->generation_;
+        }
+    };
+
+    // 치환표를 사용하는 알파-베타 가지치기와 반복 심화 탐색
+    class TranspositionSearch
+    {
+    public:
+        TranspositionTable table_;
+        int64_t node_number_ = 0; // alphaBetaScore를 호출한 횟수
+
+        TranspositionSearch(const int log2_table_size = 16) : table_(log2_table_size) {}
+
+        // 치환표에 저장된 최선의 행동을 맨 앞으로 옮긴다.
+        static void orderActions(std::vector<int> &legal_actions, const int best_action)
+        {
+            auto itr = std::find(legal_actions.begin(), legal_actions.end(), best_action);
+            if (itr != legal_actions.end())
+            {
+                std::rotate(legal_actions.begin(), itr, itr + 1);
+            }
+        }
+
+        // 제한 시간이 넘으면 정지하는 알파-베타 가지치기용 점수 계산
+        ScoreType alphaBetaScore(const State &state, ScoreType alpha, const ScoreType beta, const int depth, const TimeKeeper &time_keeper)
+        {
+            ++this->node_number_;
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (state.isDone() || depth == 0)
+            {
+                return state.getScore();
+            }
+            int tt_action = -1;
+            if (const auto *entry = this->table_.probe(state.hash_))
+            {
+                tt_action = entry->best_action_;
+                if (entry->depth_ >= depth)
+                {
+                    if (entry->bound_ == Bound::EXACT ||
+                        (entry->bound_ == Bound::LOWER && entry->score_ >= beta) ||
+                        (entry->bound_ == Bound::UPPER && entry->score_ <= alpha))
+                    {
+                        return entry->score_;
+                    }
+                }
+            }
+            auto legal_actions = state.legalActions();
+            if (legal_actions.empty())
+            {
+                return state.getScore();
+            }
+            orderActions(legal_actions, tt_action);
+            const ScoreType original_alpha = alpha;
+            int best_action = legal_actions[0];
+            for (const auto action : legal_actions)
+            {
+                State next_state = state;
+                next_state.advance(action);
+                ScoreType score = -alphaBetaScore(next_state, -beta, -alpha, depth - 1, time_keeper);
+                if (time_keeper.isTimeOver())
+                    return 0; // 도중에 중단한 결과는 저장하지 않는다.
+                if (score > alpha)
+                {
+                    best_action = action;
+                    alpha = score;
+                }
+                if (alpha >= beta)
+                {
+                    break;
+                }
+            }
+            Bound bound = Bound::EXACT;
+            if (alpha >= beta)
+            {
+                bound = Bound::LOWER;
+            }
+            else if (alpha <= original_alpha)
+            {
+                bound = Bound::UPPER;
+            }
+            this->table_.store(state.hash_, depth, bound, alpha, best_action);
+            return alpha;
+        }
+
+        // 깊이와 제한 시간(밀리초)을 지정해서 알파-베타 가지치기로 행동을 결정한다.
+        int alphaBetaActionWithTimeThreshold(const State &state, const int depth, const TimeKeeper &time_keeper)
+        {
+            auto legal_actions = state.legalActions();
+            if (const auto *entry = this->table_.probe(state.hash_))
+            {
+                orderActions(legal_actions, entry->best_action_);
+            }
+            int best_action = -1;
+            ScoreType alpha = -INF;
+            for (const auto action : legal_actions)
+            {
+                State next_state = state;
+                next_state.advance(action);
+                ScoreType score = -alphaBetaScore(next_state, -INF, -alpha, depth, time_keeper);
+                if (time_keeper.isTimeOver())
+                    return 0;
+                if (score > alpha)
+                {
+                    best_action = action;
+                    alpha = score;
+                }
+            }
+            this->table_.store(state.hash_, depth + 1, Bound::EXACT, alpha, best_action);
+            return best_action;
+        }
+
+        // 제한 시간(밀리초)을 지정해서 반복 심화 탐색으로 행동을 결정한다.
+        int iterativeDeepeningAction(const State &state, const int64_t time_threshold)
+        {
+            this->table_.newSearch();
+            auto time_keeper = TimeKeeper(time_threshold);
+            int best_action = -1;
+            for (int depth = 1;; depth++)
+            {
+                int action = alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+
+                if (time_keeper.isTimeOver())
+                {
+                    break;
+                }
+                else
+                {
+                    best_action = action;
+                }
+            }
+            return best_action;
+        }
+    };
+}
+
+namespace move_ordering
+{
+    constexpr const int MAX_PLY = END_TURN + 1;  // 루트에서의 최대 깊이
+    constexpr const int MOVE_KEY_NUMBER = H * W; // 수 키의 종류 수
+
+    // 수 순서 정렬을 사용하는 알파-베타 가지치기와 반복 심화 탐색
+    // 루트에서는 이전 반복의 점수 순으로, 그 밖의 노드에서는 치환표의 최선수, 킬러 수, 히스토리 점수 순으로 행동을 시도한다.
+    // 킬러 수와 히스토리는 행동이 도착하는 칸(State::moveKey)으로 관리한다.
+    class OrderedSearch
+    {
+    private:
+        bool use_table_;                                     // 치환표를 사용할지 여부
+        int killers_[MAX_PLY][2];                            // 깊이별로 최근에 beta 가지치기를 일으킨 수
+        int64_t history_[2][MOVE_KEY_NUMBER];                // 두는 쪽별로 beta 가지치기를 일으킨 수의 누적 점수
+        std::vector<std::pair<int, ScoreType>> root_scores_; // 이전 반복에서의 루트 행동별 점수
+
+        // 행동을 시도할 순서로 정렬한다.
+        void orderActions(const State &state, std::vector<int> &legal_actions, const int tt_action, const int ply) const
+        {
+            std::array<int64_t, 4> keys;
+            for (int i = 0; i < legal_actions.size(); i++)
+            {
+                const int action = legal_actions[i];
+                const int move_key = state.moveKey(action);
+                if (action == tt_action)
+                    keys[action] = std::numeric_limits<int64_t>::max();
+                else if (move_key == this->killers_[ply][0])
+                    keys[action] = std::numeric_limits<int64_t>::max() - 1;
+                else if (move_key == this->killers_[ply][1])
+                    keys[action] = std::numeric_limits<int64_t>::max() - 2;
+                else
+                    keys[action] = this->history_[ply % 2][move_key];
+            }
+            std::stable_sort(legal_actions.begin(), legal_actions.end(), [&keys](const int a, const int b)
+                             { return keys[a] > keys[b]; });
+        }
+
+        // beta 가지치기를 일으킨 수를 킬러 수와 히스토리에 기록한다.
+        void recordCutoff(const int move_key, const int depth, const int ply)
+        {
+            if (this->killers_[ply][0] != move_key)
+            {
+                this->killers_[ply][1] = this->killers_[ply][0];
+                this->killers_[ply][0] = move_key;
+            }
+            this->history_[ply % 2][move_key] += depth * depth;
+        }
+
+    public:
+        transposition::TranspositionTable table_;
+        int64_t node_number_ = 0; // alphaBetaScore를 호출한 횟수
+
+        OrderedSearch(const bool use_table = true, const int log2_table_size = 16) : use_table_(use_table), table_(log2_table_size)
+        {
+            this->newSearch();
+        }
+
+        // 새 탐색(행동 결정)을 시작한다. 킬러 수는 지우고 히스토리는 절반으로 줄여서 최근 결과를 우선한다.
+        void newSearch()
+        {
+            for (auto &killers : this->killers_)
+            {
+                killers[0] = killers[1] = -1;
+            }
+            for (auto &history : this->history_)
+            {
+                for (auto &value : history)
+                {
+                    value /= 2;
+                }
+            }
+            this->root_scores_.clear();
+            this->table_.newSearch();
+        }
+
+        // 제한 시간이 넘으면 정지하는 알파-베타 가지치기용 점수 계산
+        ScoreType alphaBetaScore(const State &state, ScoreType alpha, const ScoreType beta, const int depth, const int ply, const TimeKeeper &time_keeper)
+        {
+            using transposition::Bound;
+            ++this->node_number_;
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (state.isDone() || depth == 0)
+            {
+                return state.getScore();
+            }
+            int tt_action = -1;
+            if (this->use_table_)
+            {
+                if (const auto *entry = this->table_.probe(state.hash_))
+                {
+                    tt_action = entry->best_action_;
+                    if (entry->depth_ >= depth)
+                    {
+                        if (entry->bound_ == Bound::EXACT ||
+                            (entry->bound_ == Bound::LOWER && entry->score_ >= beta) ||
+                            (entry->bound_ == Bound::UPPER && entry->score_ <= alpha))
+                        {
+                            return entry->score_;
+                        }
+                    }
+                }
+            }
+            auto legal_actions = state.legalActions();
+            if (legal_actions.empty())
+            {
+                return state.getScore();
+            }
+            this->orderActions(state, legal_actions, tt_action, ply);
+            const ScoreType original_alpha = alpha;
+            int best_action = legal_actions[0];
+            for (const auto action : legal_actions)
+            {
+                State next_state = state;
+                next_state.advance(action);
+                ScoreType score = -alphaBetaScore(next_state, -beta, -alpha, depth - 1, ply + 1, time_keeper);
+                if (time_keeper.isTimeOver())
+                    return 0; // 도중에 중단한 결과는 저장하지 않는다.
+                if (score > alpha)
+                {
+                    best_action = action;
+                    alpha = score;
+                }
+                if (alpha >= beta)
+                {
+                    this->recordCutoff(state.moveKey(action), depth, ply);
+                    break;
+                }
+            }
+            if (this->use_table_)
+            {
+                Bound bound = Bound::EXACT;
+                if (alpha >= beta)
+                {
+                    bound = Bound::LOWER;
+                }
+                else if (alpha <= original_alpha)
+                {
+                    bound = Bound::UPPER;
+                }
+                this->table_.store(state.hash_, depth, bound, alpha, best_action);
+            }
+            return alpha;
+        }
+
+        // 깊이와 제한 시간(밀리초)을 지정해서 알파-베타 가지치기로 행동을 결정한다.
+        // 이전 반복의 점수가 높은 행동부터 시도하고, 이번 반복의 점수를 다음 반복을 위해 기록한다.
+        int alphaBetaActionWithTimeThreshold(const State &state, const int depth, const TimeKeeper &time_keeper)
+        {
+            if (this->root_scores_.empty())
+            {
+                for (const auto action : state.legalActions())
+                {
+                    this->root_scores_.emplace_back(action, -INF);
+                }
+            }
+            std::stable_sort(this->root_scores_.begin(), this->root_scores_.end(), [](const std::pair<int, ScoreType> &a, const std::pair<int, ScoreType> &b)
+                             { return a.second > b.second; });
+            auto scores = this->root_scores_;
+            int best_action = -1;
+            ScoreType alpha = -INF;
+            for (auto &action_score : scores)
+            {
+                const int action = action_score.first;
+                State next_state = state;
+                next_state.advance(action);
+                ScoreType score = -alphaBetaScore(next_state, -INF, -alpha, depth, 1, time_keeper);
+                if (time_keeper.isTimeOver())
+                    return 0;
+                action_score.second = score;
+                if (score > alpha)
+                {
+                    best_action = action;
+                    alpha = score;
+                }
+            }
+            this->root_scores_ = scores;
+            if (this->use_table_)
+            {
+                this->table_.store(state.hash_, depth + 1, transposition::Bound::EXACT, alpha, best_action);
+            }
+            return best_action;
+        }
+
+        // 제한 시간(밀리초)을 지정해서 반복 심화 탐색으로 행동을 결정한다.
+        int iterativeDeepeningAction(const State &state, const int64_t time_threshold)
+        {
+            this->newSearch();
+            auto time_keeper = TimeKeeper(time_threshold);
+            int best_action = -1;
+            for (int depth = 1;; depth++)
+            {
+                int action = alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+
+                if (time_keeper.isTimeOver())
+                {
+                    break;
+                }
+                else
+                {
+                    best_action = action;
+                }
+            }
+            return best_action;
+        }
+    };
+}
+
+using AIFunction = std::function<int(const State &)>;
+using StringAIPair = std::pair<std::string, AIFunction>;
+
+// 게임을 game_number×2(선공과 후공을 교대)횟수만큼 플레이해서 ais의 0번째에 있는 AI 승률을 표시한다.
+void testFirstPlayerWinRate(const std::array<StringAIPair, 2> &ais, const int game_number)
+{
+    using std::cout;
+    using std::endl;
+
+    double first_player_win_rate = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto base_state = State(i);
+        for (int j = 0; j < 2; j++)
+        { // 공평하게 선공과 후공을 교대함
+            auto state = base_state;
+            auto &first_ai = ais[j];
+            auto &second_ai = ais[(j + 1) % 2];
+            while (true)
+            {
+                state.advance(first_ai.second(state));
+                if (state.isDone())
+                    break;
+                state.advance(second_ai.second(state));
+                if (state.isDone())
+                    break;
+            }
+            double win_rate_point = state.getFirstPlayerScoreForWinRate();
+            if (j == 1)
+                win_rate_point = 1 - win_rate_point;
+            if (win_rate_point >= 0)
+            {
+                state.toString();
+            }
+            first_player_win_rate += win_rate_point;
+        }
+        cout << "i " << i << " w " << first_player_win_rate / ((i + 1) * 2) << endl;
+    }
+    first_player_win_rate /= (double)(game_number * 2);
+    cout << "Winning rate of " << ais[0].first << " to " << ais[1].first << ":\t" << first_player_win_rate << endl;
+}
+
+
+// 게임판마다 깊이 1부터 max_depth까지 반복 심화하면서, 탐색 방법별로 각 반복의 1회 탐색당 평균 노드 수를 표시한다.
+void testNodeNumber(const std::vector<State> &states, const int max_depth)
+{
+    using std::cout;
+    using std::endl;
+    auto time_keeper = TimeKeeper(INF);
+    constexpr const int SEARCH_NUMBER = 4;
+    std::vector<std::array<int64_t, SEARCH_NUMBER>> node_numbers(max_depth + 1, std::array<int64_t, SEARCH_NUMBER>{});
+    for (const auto &state : states)
+    {
+        auto tt_search = transposition::TranspositionSearch();
+        auto ordered_search = move_ordering::OrderedSearch(false);
+        auto ordered_tt_search = move_ordering::OrderedSearch(true);
+        for (int depth = 1; depth <= max_depth; depth++)
+        {
+            const std::array<int64_t, SEARCH_NUMBER> before = {iterativedeepening::node_number, ordered_search.node_number_, tt_search.node_number_, ordered_tt_search.node_number_};
+            iterativedeepening::alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+            ordered_search.alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+            tt_search.alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+            ordered_tt_search.alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+            const std::array<int64_t, SEARCH_NUMBER> after = {iterativedeepening::node_number, ordered_search.node_number_, tt_search.node_number_, ordered_tt_search.node_number_};
+            for (int i = 0; i < SEARCH_NUMBER; i++)
+            {
+                node_numbers[depth][i] += after[i] - before[i];
+            }
+        }
+    }
+    cout << "depth\tplain\tordering\ttt\ttt+ordering" << endl;
+    std::array<int64_t, SEARCH_NUMBER> total = {};
+    for (int depth = 1; depth <= max_depth; depth++)
+    {
+        cout << depth;
+        for (int i = 0; i < SEARCH_NUMBER; i++)
+        {
+            cout << "\t" << (double)node_numbers[depth][i] / states.size();
+            total[i] += node_numbers[depth][i];
+        }
+        cout << endl;
+    }
+    cout << "total";
+    for (int i = 0; i < SEARCH_NUMBER; i++)
+    {
+        cout << "\t" << (double)total[i] / states.size();
+    }
+    cout << endl;
+}
+
+int main()
+{
+    zobrist_hash::init(); // 반드시 시작할 때 호출한다.
+    std::vector<State> states;
+    for (int i = 0; i < 100; i++)
+    {
+        states.emplace_back(State(i));
+    }
+    testNodeNumber(states, END_TURN - 1);
+
+    auto ordered_search = move_ordering::OrderedSearch(false);
+    auto ais = std::array<StringAIPair, 2>{
+        StringAIPair("OrderedSearch::iterativeDeepeningAction 1", [&ordered_search](const State &state)
+                     { return ordered_search.iterativeDeepeningAction(state, 1); }),
+        StringAIPair("iterativeDeepeningAction 1", [](const State &state)
+                     { return iterativeDeepeningAction(state, 1); }),
+    };
+    testFirstPlayerWinRate(ais, 100);
+
+    return 0;
+}
@@ -0,0 +1,1078 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <array>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+#include <queue>
+#include <set>
+#include <cstdint>
+#include <type_traits>
+#pragma GCC diagnostic ignored "-Wsign-compare"
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+constexpr const int H = 5;   // 미로의 높이
+constexpr const int W = 5;   // 미로의 너비
+constexpr int END_TURN = 10; // 게임 종료 턴
+
+using ScoreType = int64_t;
+constexpr const ScoreType INF = 1000000000LL;
+
+enum WinningStatus
+{
+    WIN,
+    LOSE,
+    DRAW,
+    NONE,
+};
+
+class AlternateMazeState
+{
+public:
+    static constexpr const int MAX_ACTION_NUMBER = 4; // 한 턴에 가능한 행동 수의 최댓값
+
+    // [make/unmake] : advance를 되돌리기 위해 기록하는 정보
+    struct Undo
+    {
+        uint8_t action_;         // 이동한 방향
+        uint8_t captured_point_; // 이동한 칸에서 얻은 점수(없으면 0)
+    };
+
+private:
+    static constexpr const int dx[4] = {1, -1, 0, 0};
+    static constexpr const int dy[4] = {0, 0, 1, -1};
+    // [고정 크기 배치] : 게임판을 힙을 쓰지 않는 고정 크기 배열로 두어서 복사가 memcpy 한 번으로 끝나게 한다.
+    struct Character
+    {
+        uint8_t y_;
+        uint8_t x_;
+        uint16_t game_score_;
+        Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+    };
+    std::array<std::array<uint8_t, W>, H> points_; // 바닥의 점수는 1~9 중 하나
+    uint8_t turn_;                                 // 현재 턴
+    std::array<Character, 2> characters_;
+
+    // 현재 플레이어가 선공인지 판정한다.
+    bool isFirstPlayer() const
+    {
+        return this->turn_ % 2 == 0;
+    }
+
+public:
+    AlternateMazeState(const int seed) : points_(),
+                                         turn_(0),
+                                         characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+    {
+        auto mt_for_construct = std::mt19937(seed);
+
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                int point = mt_for_construct() % 10;
+                if (characters_[0].y_ == y && characters_[0].x_ == x)
+                {
+                    continue;
+                }
+                if (characters_[1].y_ == y && characters_[1].x_ == x)
+                {
+                    continue;
+                }
+
+                this->points_[y][x] = point;
+            }
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return this->turn_ == END_TURN;
+    }
+
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+    void advance(const int action)
+    {
+        auto &character = this->characters_[0];
+        character.x_ += dx[action];
+        character.y_ += dy[action];
+        auto &point = this->points_[character.y_][character.x_];
+        if (point > 0)
+        {
+            character.game_score_ += point;
+            point = 0;
+        }
+        this->turn_++;
+        std::swap(this->characters_[0], this->characters_[1]);
+    }
+
+    // [make/unmake] : 지정한 action으로 게임을 1턴 진행하고, 되돌리기 위한 정보를 undo에 기록한다.
+    void advance(const int action, Undo &undo)
+    {
+        auto &character = this->characters_[0];
+        character.x_ += dx[action];
+        character.y_ += dy[action];
+        auto &point = this->points_[character.y_][character.x_];
+        undo.action_ = action;
+        undo.captured_point_ = point;
+        if (point > 0)
+        {
+            character.game_score_ += point;
+            point = 0;
+        }
+        this->turn_++;
+        std::swap(this->characters_[0], this->characters_[1]);
+    }
+
+    // [make/unmake] : advance(action, undo)로 진행한 1턴을 되돌린다.
+    void unadvance(const Undo &undo)
+    {
+        std::swap(this->characters_[0], this->characters_[1]);
+        this->turn_--;
+        auto &character = this->characters_[0];
+        if (undo.captured_point_ > 0)
+        {
+            this->points_[character.y_][character.x_] = undo.captured_point_;
+            character.game_score_ -= undo.captured_point_;
+        }
+        character.x_ -= dx[undo.action_];
+        character.y_ -= dy[undo.action_];
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        const auto &character = this->characters_[0];
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = character.y_ + dy[action];
+            int tx = character.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+            {
+                actions.emplace_back(action);
+            }
+        }
+        return actions;
+    }
+
+    // [make/unmake] : 현재 플레이어가 가능한 행동을 actions에 기록하고 개수를 돌려준다.
+    int legalActions(int *actions) const
+    {
+        int action_number = 0;
+        const auto &character = this->characters_[0];
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = character.y_ + dy[action];
+            int tx = character.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+            {
+                actions[action_number++] = action;
+            }
+        }
+        return action_number;
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        if (isDone())
+        {
+            if (characters_[0].game_score_ > characters_[1].game_score_)
+                return WinningStatus::WIN;
+            else if (characters_[0].game_score_ < characters_[1].game_score_)
+                return WinningStatus::LOSE;
+            else
+                return WinningStatus::DRAW;
+        }
+        else
+        {
+            return WinningStatus::NONE;
+        }
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가한다.
+    ScoreType getScore() const
+    {
+        return characters_[0].game_score_ - characters_[1].game_score_;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+    double getFirstPlayerScoreForWinRate() const
+    {
+        switch (this->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            if (this->isFirstPlayer())
+            {
+                return 1.;
+            }
+            else
+            {
+                return 0.;
+            }
+        case (WinningStatus::LOSE):
+            if (this->isFirstPlayer())
+            {
+                return 0.;
+            }
+            else
+            {
+                return 1.;
+            }
+        default:
+            return 0.5;
+        }
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss("");
+        ss << "turn:\t" << (int)this->turn_ << "\n";
+        for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+        {
+            int actual_player_id = player_id;
+            if (this->turn_ % 2 == 1)
+            {
+                actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+            }
+            const auto &chara = this->characters_[actual_player_id];
+            ss << "score(" << player_id << "):\t" << chara.game_score_ << "\ty: " << (int)chara.y_ << " x: " << (int)chara.x_ << "\n";
+        }
+        for (int h = 0; h < H; h++)
+        {
+            for (int w = 0; w < W; w++)
+            {
+                bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                {
+                    int actual_player_id = player_id;
+                    if (this->turn_ % 2 == 1)
+                    {
+                        actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                    }
+
+                    const auto &character = this->characters_[player_id];
+                    if (character.y_ == h && character.x_ == w)
+                    {
+                        if (actual_player_id == 0)
+                        {
+                            ss << 'A';
+                        }
+                        else
+                        {
+                            ss << 'B';
+                        }
+                        is_written = true;
+                    }
+                }
+                if (!is_written)
+                {
+                    if (this->points_[h][w] > 0)
+                    {
+                        ss << (int)points_[h][w];
+                    }
+                    else
+                    {
+                        ss << '.';
+                    }
+                }
+            }
+            ss << '\n';
+        }
+
+        return ss.str();
+    }
+};
+
+// [고정 크기 배치] : 좌표, 점수, 턴이 uint8_t, uint16_t에 들어가는지 확인한다.
+static_assert(H <= UINT8_MAX && W <= UINT8_MAX && END_TURN <= UINT8_MAX, "board does not fit in uint8_t");
+static_assert(H * W * 9 <= UINT16_MAX, "game score does not fit in uint16_t");
+static_assert(std::is_trivially_copyable<AlternateMazeState>::value, "AlternateMazeState must be trivially copyable");
+static_assert(sizeof(AlternateMazeState) <= 64, "AlternateMazeState must fit in a cache line");
+
+using State = AlternateMazeState;
+
+namespace vector_layout
+{
+    // 비교용 : 게임판을 std::vector로 보관하는 기존 배치
+    class VectorMazeState
+    {
+    private:
+        static constexpr const int dx[4] = {1, -1, 0, 0};
+        static constexpr const int dy[4] = {0, 0, 1, -1};
+        struct Character
+        {
+            int y_;
+            int x_;
+            int game_score_;
+            Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+        };
+        std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+        int turn_;                             // 현재 턴
+        std::vector<Character> characters_;
+
+        // 현재 플레이어가 선공인지 판정한다.
+        bool isFirstPlayer() const
+        {
+            return this->turn_ % 2 == 0;
+        }
+
+    public:
+        VectorMazeState(const int seed) : points_(H, std::vector<int>(W)),
+                                             turn_(0),
+                                             characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+        {
+            auto mt_for_construct = std::mt19937(seed);
+
+            for (int y = 0; y < H; y++)
+                for (int x = 0; x < W; x++)
+                {
+                    int point = mt_for_construct() % 10;
+                    if (characters_[0].y_ == y && characters_[0].x_ == x)
+                    {
+                        continue;
+                    }
+                    if (characters_[1].y_ == y && characters_[1].x_ == x)
+                    {
+                        continue;
+                    }
+
+                    this->points_[y][x] = point;
+                }
+        }
+
+        // [모든 게임에서 구현] : 게임 종료 판정
+        bool isDone() const
+        {
+            return this->turn_ == END_TURN;
+        }
+
+        // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+        void advance(const int action)
+        {
+            auto &character = this->characters_[0];
+            character.x_ += dx[action];
+            character.y_ += dy[action];
+            auto &point = this->points_[character.y_][character.x_];
+            if (point > 0)
+            {
+                character.game_score_ += point;
+                point = 0;
+            }
+            this->turn_++;
+            std::swap(this->characters_[0], this->characters_[1]);
+        }
+
+        // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+        std::vector<int> legalActions() const
+        {
+            std::vector<int> actions;
+            const auto &character = this->characters_[0];
+            for (int action = 0; action < 4; action++)
+            {
+                int ty = character.y_ + dy[action];
+                int tx = character.x_ + dx[action];
+                if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+                {
+                    actions.emplace_back(action);
+                }
+            }
+            return actions;
+        }
+
+        // [모든 게임에서 구현] : 승패 정보를 획득한다.
+        WinningStatus getWinningStatus() const
+        {
+            if (isDone())
+            {
+                if (characters_[0].game_score_ > characters_[1].game_score_)
+                    return WinningStatus::WIN;
+                else if (characters_[0].game_score_ < characters_[1].game_score_)
+                    return WinningStatus::LOSE;
+                else
+                    return WinningStatus::DRAW;
+            }
+            else
+            {
+                return WinningStatus::NONE;
+            }
+        }
+
+        // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가한다.
+        ScoreType getScore() const
+        {
+            return characters_[0].game_score_ - characters_[1].game_score_;
+        }
+
+        // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+        double getFirstPlayerScoreForWinRate() const
+        {
+            switch (this->getWinningStatus())
+            {
+            case (WinningStatus::WIN):
+                if (this->isFirstPlayer())
+                {
+                    return 1.;
+                }
+                else
+                {
+                    return 0.;
+                }
+            case (WinningStatus::LOSE):
+                if (this->isFirstPlayer())
+                {
+                    return 0.;
+                }
+                else
+                {
+                    return 1.;
+                }
+            default:
+                return 0.5;
+            }
+        }
+
+        // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+        std::string toString() const
+        {
+            std::stringstream ss("");
+            ss << "turn:\t" << this->turn_ << "\n";
+            for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+            {
+                int actual_player_id = player_id;
+                if (this->turn_ % 2 == 1)
+                {
+                    actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                }
+                const auto &chara = this->characters_[actual_player_id];
+                ss << "score(" << player_id << "):\t" << chara.game_score_ << "\ty: " << chara.y_ << " x: " << chara.x_ << "\n";
+            }
+            for (int h = 0; h < H; h++)
+            {
+                for (int w = 0; w < W; w++)
+                {
+                    bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                    for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                    {
+                        int actual_player_id = player_id;
+                        if (this->turn_ % 2 == 1)
+                        {
+                            actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                        }
+
+                        const auto &character = this->characters_[player_id];
+                        if (character.y_ == h && character.x_ == w)
+                        {
+                            if (actual_player_id == 0)
+                            {
+                                ss << 'A';
+                            }
+                            else
+                            {
+                                ss << 'B';
+                            }
+                            is_written = true;
+                        }
+                    }
+                    if (!is_written)
+                    {
+                        if (this->points_[h][w] > 0)
+                        {
+                            ss << points_[h][w];
+                        }
+                        else
+                        {
+                            ss << '.';
+                        }
+                    }
+                }
+                ss << '\n';
+            }
+
+            return ss.str();
+        }
+    };
+
+}
+
+// 무작위로 행동을 결정한다.
+int randomAction(const State &state)
+{
+    auto legal_actions = state.legalActions();
+    return legal_actions[mt_for_action() % (legal_actions.size())];
+}
+
+namespace minimax
+{
+    // 미니맥스 알고리즘용 기록 점수 계산
+    ScoreType miniMaxScore(const State &state, const int depth)
+    {
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        auto legal_actions = state.legalActions();
+        if (legal_actions.empty())
+        {
+            return state.getScore();
+        }
+        ScoreType bestScore = -INF;
+        for (const auto action : legal_actions)
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -miniMaxScore(next_state, depth - 1);
+            if (score > bestScore)
+            {
+                bestScore = score;
+            }
+        }
+        return bestScore;
+    }
+    // 깊이를 지정해서 미니맥스 알고리즘으로 행동을 결정한다.
+    int miniMaxAction(const State &state, const int depth)
+    {
+        ScoreType best_action = -1;
+        ScoreType best_score = -INF;
+        for (const auto action : state.legalActions())
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -miniMaxScore(next_state, depth);
+            if (score > best_score)
+            {
+                best_action = action;
+                best_score = score;
+            }
+        }
+        return best_action;
+    }
+}
+using minimax::miniMaxAction;
+
+namespace alphabeta
+{
+    // 알파-베타 가지치기용 점수 계산
+    ScoreType alphaBetaScore(const State &state, ScoreType alpha, const ScoreType beta, const int depth)
+    {
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        auto legal_actions = state.legalActions();
+        if (legal_actions.empty())
+        {
+            return state.getScore();
+        }
+        for (const auto action : legal_actions)
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -beta, -alpha, depth - 1);
+            if (score > alpha)
+            {
+                alpha = score;
+            }
+            if (alpha >= beta)
+            {
+                return alpha;
+            }
+        }
+        return alpha;
+    }
+    // 깊이를 지정해서 알파-베타 가지치기로 행동을 결정한다.
+    int alphaBetaAction(const State &state, const int depth)
+    {
+        ScoreType best_action = -1;
+        ScoreType alpha = -INF;
+        ScoreType beta = INF;
+        for (const auto action : state.legalActions())
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -beta, -alpha, depth);
+            if (score > alpha)
+            {
+                best_action = action;
+                alpha = score;
+            }
+        }
+        return best_action;
+    }
+}
+using alphabeta::alphaBetaAction;
+
+namespace iterativedeepening
+{
+    int64_t node_number = 0; // alphaBetaScore를 호출한 횟수
+
+    // 제한 시간이 넘으면 정지하는 알파-베타 가지치기용 점수 계산
+    ScoreType alphaBetaScore(const State &state, ScoreType alpha, const ScoreType beta, const int depth, const TimeKeeper &time_keeper)
+    {
+        ++node_number;
+        if (time_keeper.isTimeOver())
+            return 0;
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        auto legal_actions = state.legalActions();
+        if (legal_actions.empty())
+        {
+            return state.getScore();
+        }
+        for (const auto action : legal_actions)
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -beta, -alpha, depth - 1, time_keeper);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                alpha = score;
+            }
+            if (alpha >= beta)
+            {
+                return alpha;
+            }
+        }
+        return alpha;
+    }
+    // 깊이와 제한 시간(밀리초)을 지정해서 알파-베타 가지치기로 행동을 결정한다.
+    int alphaBetaActionWithTimeThreshold(const State &state, const int depth, const TimeKeeper &time_keeper)
+    {
+        ScoreType best_action = -1;
+        ScoreType alpha = -INF;
+        for (const auto action : state.legalActions())
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -INF, -alpha, depth, time_keeper);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                best_action = action;
+                alpha = score;
+            }
+        }
+        return best_action;
+    }
+
+    // 제한 시간(밀리초)을 지정해서 반복 심화 탐색으로 행동을 결정한다.
+    int iterativeDeepeningAction(const State &state, const int64_t time_threshold)
+    {
+        auto time_keeper = TimeKeeper(time_threshold);
+        int best_action = -1;
+        for (int depth = 1;; depth++)
+        {
+            int action = alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            else
+            {
+                best_action = action;
+            }
+        }
+        return best_action;
+    }
+}
+using iterativedeepening::iterativeDeepeningAction;
+
+namespace undo
+{
+    // 미니맥스 알고리즘용 기록 점수 계산
+    // 게임판을 복사하지 않고 하나의 게임판을 진행하고 되돌리면서 탐색한다.
+    ScoreType miniMaxScore(State &state, const int depth)
+    {
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        int legal_actions[State::MAX_ACTION_NUMBER];
+        const int action_number = state.legalActions(legal_actions);
+        if (action_number == 0)
+        {
+            return state.getScore();
+        }
+        ScoreType bestScore = -INF;
+        State::Undo undo;
+        for (int i = 0; i < action_number; i++)
+        {
+            state.advance(legal_actions[i], undo);
+            ScoreType score = -miniMaxScore(state, depth - 1);
+            state.unadvance(undo);
+            if (score > bestScore)
+            {
+                bestScore = score;
+            }
+        }
+        return bestScore;
+    }
+    // 깊이를 지정해서 미니맥스 알고리즘으로 행동을 결정한다.
+    int miniMaxAction(const State &state, const int depth)
+    {
+        State search_state = state;
+        ScoreType best_action = -1;
+        ScoreType best_score = -INF;
+        int legal_actions[State::MAX_ACTION_NUMBER];
+        const int action_number = search_state.legalActions(legal_actions);
+        State::Undo undo;
+        for (int i = 0; i < action_number; i++)
+        {
+            search_state.advance(legal_actions[i], undo);
+            ScoreType score = -miniMaxScore(search_state, depth);
+            search_state.unadvance(undo);
+            if (score > best_score)
+            {
+                best_action = legal_actions[i];
+                best_score = score;
+            }
+        }
+        return best_action;
+    }
+
+    // 알파-베타 가지치기용 점수 계산
+    ScoreType alphaBetaScore(State &state, ScoreType alpha, const ScoreType beta, const int depth)
+    {
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        int legal_actions[State::MAX_ACTION_NUMBER];
+        const int action_number = state.legalActions(legal_actions);
+        if (action_number == 0)
+        {
+            return state.getScore();
+        }
+        State::Undo undo;
+        for (int i = 0; i < action_number; i++)
+        {
+            state.advance(legal_actions[i], undo);
+            ScoreType score = -alphaBetaScore(state, -beta, -alpha, depth - 1);
+            state.unadvance(undo);
+            if (score > alpha)
+            {
+                alpha = score;
+            }
+            if (alpha >= beta)
+            {
+                return alpha;
+            }
+        }
+        return alpha;
+    }
+    // 깊이를 지정해서 알파-베타 가지치기로 행동을 결정한다.
+    int alphaBetaAction(const State &state, const int depth)
+    {
+        State search_state = state;
+        ScoreType best_action = -1;
+        ScoreType alpha = -INF;
+        ScoreType beta = INF;
+        int legal_actions[State::MAX_ACTION_NUMBER];
+        const int action_number = search_state.legalActions(legal_actions);
+        State::Undo undo;
+        for (int i = 0; i < action_number; i++)
+        {
+            search_state.advance(legal_actions[i], undo);
+            ScoreType score = -alphaBetaScore(search_state, -beta, -alpha, depth);
+            search_state.unadvance(undo);
+            if (score > alpha)
+            {
+                best_action = legal_actions[i];
+                alpha = score;
+            }
+        }
+        return best_action;
+    }
+
+    int64_t node_number = 0; // alphaBetaScoreWithTimeThreshold를 호출한 횟수
+
+    // 제한 시간이 넘으면 정지하는 알파-베타 가지치기용 점수 계산
+    ScoreType alphaBetaScoreWithTimeThreshold(State &state, ScoreType alpha, const ScoreType beta, const int depth, const TimeKeeper &time_keeper)
+    {
+        ++node_number;
+        if (time_keeper.isTimeOver())
+            return 0;
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        int legal_actions[State::MAX_ACTION_NUMBER];
+        const int action_number = state.legalActions(legal_actions);
+        if (action_number == 0)
+        {
+            return state.getScore();
+        }
+        State::Undo undo;
+        for (int i = 0; i < action_number; i++)
+        {
+            state.advance(legal_actions[i], undo);
+            ScoreType score = -alphaBetaScoreWithTimeThreshold(state, -beta, -alpha, depth - 1, time_keeper);
+            state.unadvance(undo); // 시간 초과로 빠져나갈 때도 게임판을 먼저 되돌린다.
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                alpha = score;
+            }
+            if (alpha >= beta)
+            {
+                return alpha;
+            }
+        }
+        return alpha;
+    }
+    // 깊이와 제한 시간(밀리초)을 지정해서 알파-베타 가지치기로 행동을 결정한다.
+    int alphaBetaActionWithTimeThreshold(State &state, const int depth, const TimeKeeper &time_keeper)
+    {
+        ScoreType best_action = -1;
+        ScoreType alpha = -INF;
+        int legal_actions[State::MAX_ACTION_NUMBER];
+        const int action_number = state.legalActions(legal_actions);
+        State::Undo undo;
+        for (int i = 0; i < action_number; i++)
+        {
+            state.advance(legal_actions[i], undo);
+            ScoreType score = -alphaBetaScoreWithTimeThreshold(state, -INF, -alpha, depth, time_keeper);
+            state.unadvance(undo);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                best_action = legal_actions[i];
+                alpha = score;
+            }
+        }
+        return best_action;
+    }
+
+    // 제한 시간(밀리초)을 지정해서 반복 심화 탐색으로 행동을 결정한다.
+    int iterativeDeepeningAction(const State &state, const int64_t time_threshold)
+    {
+        auto time_keeper = TimeKeeper(time_threshold);
+        State search_state = state;
+        int best_action = -1;
+        for (int depth = 1;; depth++)
+        {
+            int action = alphaBetaActionWithTimeThreshold(search_state, depth, time_keeper);
+
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            else
+            {
+                best_action = action;
+            }
+        }
+        return best_action;
+    }
+}
+
+using AIFunction = std::function<int(const State &)>;
+using StringAIPair = std::pair<std::string, AIFunction>;
+
+// 게임을 game_number×2(선공과 후공을 교대)횟수만큼 플레이해서 ais의 0번째에 있는 AI 승률을 표시한다.
+void testFirstPlayerWinRate(const std::array<StringAIPair, 2> &ais, const int game_number)
+{
+    using std::cout;
+    using std::endl;
+
+    double first_player_win_rate = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto base_state = State(i);
+        for (int j = 0; j < 2; j++)
+        { // 공평하게 선공과 후공을 교대함
+            auto state = base_state;
+            auto &first_ai = ais[j];
+            auto &second_ai = ais[(j + 1) % 2];
+            while (true)
+            {
+                state.advance(first_ai.second(state));
+                if (state.isDone())
+                    break;
+                state.advance(second_ai.second(state));
+                if (state.isDone())
+                    break;
+            }
+            double win_rate_point = state.getFirstPlayerScoreForWinRate();
+            if (j == 1)
+                win_rate_point = 1 - win_rate_point;
+            if (win_rate_point >= 0)
+            {
+                state.toString();
+            }
+            first_player_win_rate += win_rate_point;
+        }
+        cout << "i " << i << " w " << first_player_win_rate / ((i + 1) * 2) << endl;
+    }
+    first_player_win_rate /= (double)(game_number * 2);
+    cout << "Winning rate of " << ais[0].first << " to " << ais[1].first << ":\t" << first_player_win_rate << endl;
+}
+
+std::vector<State> getSampleStates(const int game_number)
+{
+    std::mt19937 mt_for_construct(0);
+    std::vector<State> states;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(mt_for_construct());
+        int turn = mt_for_construct() % END_TURN;
+        for (int t = 0; t < turn; t++)
+        {
+            state.advance(randomAction(state));
+        }
+        states.emplace_back(state);
+    }
+    return states;
+}
+
+void calculateExecutionSpeed(const StringAIPair &ai, const std::vector<State> &states)
+{
+    using std::cout;
+    using std::endl;
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (const auto &state : states)
+    {
+        ai.second(state);
+    }
+    auto diff = std::chrono::high_resolution_clock::now() - start_time;
+    auto time = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count();
+    cout << ai.first << " take " << time << " ms to process " << states.size() << " nodes" << endl;
+}
+
+// 제한 시간(밀리초) 동안 반복 심화 탐색을 하고, 1회 탐색당 평균 노드 수를 표시한다.
+void testIterativeDeepeningNodeNumber(const std::vector<State> &states, const int64_t time_threshold)
+{
+    using std::cout;
+    using std::endl;
+    iterativedeepening::node_number = 0;
+    undo::node_number = 0;
+    for (const auto &state : states)
+    {
+        iterativeDeepeningAction(state, time_threshold);
+        undo::iterativeDeepeningAction(state, time_threshold);
+    }
+    cout << "iterativeDeepeningAction " << time_threshold << "ms:\t" << (double)iterativedeepening::node_number / states.size() << " nodes" << endl;
+    cout << "undo::iterativeDeepeningAction " << time_threshold << "ms:\t" << (double)undo::node_number / states.size() << " nodes" << endl;
+}
+
+// 같은 행동열을 두 배치의 게임판에 적용해서 합법 수, 승패, 표시 결과가 모두 같은지 확인한다.
+void testSameTransition(const int game_number)
+{
+    using std::cout;
+    using std::endl;
+    int mismatch_number = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(i);
+        auto vector_state = vector_layout::VectorMazeState(i);
+        while (true)
+        {
+            const auto legal_actions = state.legalActions();
+            if (legal_actions != vector_state.legalActions() ||
+                state.getWinningStatus() != vector_state.getWinningStatus() ||
+                state.getScore() != vector_state.getScore() ||
+                state.toString() != vector_state.toString())
+            {
+                ++mismatch_number;
+                break;
+            }
+            if (state.isDone())
+            {
+                break;
+            }
+            const int action = legal_actions[mt_for_action() % legal_actions.size()];
+            state.advance(action);
+            vector_state.advance(action);
+        }
+    }
+    cout << "mismatch " << mismatch_number << " / " << game_number << endl;
+}
+
+// 게임판을 지정한 횟수만큼 복사하는 데 걸린 시간을 표시한다.
+template <typename CopyState>
+void testCopySpeed(const std::string &name, const int copy_number)
+{
+    using std::cout;
+    using std::endl;
+    const auto state = CopyState(0);
+    int64_t sum = 0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < copy_number; i++)
+    {
+        auto copied = state;
+        copied.advance(copied.legalActions()[0]);
+        sum += copied.getScore();
+    }
+    auto diff = std::chrono::high_resolution_clock::now() - start_time;
+    cout << name << "\tsizeof " << sizeof(CopyState) << "\t" << std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() << " ms to copy " << copy_number << " states (" << sum << ")" << endl;
+}
+
+int main()
+{
+    using std::cout;
+    using std::endl;
+    testSameTransition(1000);
+    testCopySpeed<vector_layout::VectorMazeState>("VectorMazeState", 1000000);
+    testCopySpeed<State>("AlternateMazeState", 1000000);
+
+    auto states = getSampleStates(100);
+    calculateExecutionSpeed(
+        StringAIPair("alphaBetaAction", [](const State &state)
+                     { return alphaBetaAction(state, END_TURN); }),
+        states);
+    calculateExecutionSpeed(
+        StringAIPair("undo::alphaBetaAction", [](const State &state)
+                     { return undo::alphaBetaAction(state, END_TURN); }),
+        states);
+    calculateExecutionSpeed(
+        StringAIPair("miniMaxAction", [](const State &state)
+                     { return miniMaxAction(state, END_TURN); }),
+        states);
+    calculateExecutionSpeed(
+        StringAIPair("undo::miniMaxAction", [](const State &state)
+                     { return undo::miniMaxAction(state, END_TURN); }),
+        states);
+    testIterativeDeepeningNodeNumber(states, 10);
+
+    return 0;
+}
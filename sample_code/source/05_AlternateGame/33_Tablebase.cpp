@@ -0,0 +1,1278 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <array>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#pragma GCC diagnostic ignored "-Wsign-compare"
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+constexpr const int H = 5;   // 미로의 높이
+constexpr const int W = 5;   // 미로의 너비
+constexpr int END_TURN = 10; // 게임 종료 턴
+
+using ScoreType = int64_t;
+constexpr const ScoreType INF = 1000000000LL;
+
+enum WinningStatus
+{
+    WIN,
+    LOSE,
+    DRAW,
+    NONE,
+};
+
+namespace tablebase
+{
+    // 테이블베이스에서 게임판을 찾기 위한 128비트 키
+    // 점수는 남은 턴에서 얻을 수 있는 점수 차이와 관계가 없으므로 키에 넣지 않는다.
+    struct Key
+    {
+        uint64_t low_ = 0;  // 0~15번째 칸의 점수(칸마다 4비트)
+        uint64_t high_ = 0; // 16~24번째 칸의 점수, 두 캐릭터의 위치(5비트씩), 턴(4비트)
+
+        bool operator==(const Key &other) const
+        {
+            return this->low_ == other.low_ && this->high_ == other.high_;
+        }
+    };
+    static_assert(H * W <= 25, "Key에 들어가는 칸은 25개까지다. 판을 키우면 Key의 구성을 바꿔야 한다.");
+    static_assert(END_TURN < 16, "Key의 턴은 4비트다.");
+}
+
+class AlternateMazeState
+{
+private:
+    static constexpr const int dx[4] = {1, -1, 0, 0};
+    static constexpr const int dy[4] = {0, 0, 1, -1};
+    struct Character
+    {
+        int y_;
+        int x_;
+        int game_score_;
+        Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+    };
+    std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+    int turn_;                             // 현재 턴
+    std::vector<Character> characters_;
+
+    // 현재 플레이어가 선공인지 판정한다.
+    bool isFirstPlayer() const
+    {
+        return this->turn_ % 2 == 0;
+    }
+
+public:
+    AlternateMazeState(const int seed) : points_(H, std::vector<int>(W)),
+                                         turn_(0),
+                                         characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+    {
+        auto mt_for_construct = std::mt19937(seed);
+
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                int point = mt_for_construct() % 10;
+                if (characters_[0].y_ == y && characters_[0].x_ == x)
+                {
+                    continue;
+                }
+                if (characters_[1].y_ == y && characters_[1].x_ == x)
+                {
+                    continue;
+                }
+
+                this->points_[y][x] = point;
+            }
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return this->turn_ == END_TURN;
+    }
+
+    // [테이블베이스] : 게임 종료까지 남은 턴 수
+    int remainingTurn() const
+    {
+        return END_TURN - this->turn_;
+    }
+
+    // [테이블베이스] : 바닥의 점수, 두 캐릭터의 위치, 턴을 tablebase::Key로 부호화한다.
+    tablebase::Key tablebaseKey() const
+    {
+        tablebase::Key key;
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                const int cell = y * W + x;
+                if (cell < 16)
+                {
+                    key.low_ |= (uint64_t)this->points_[y][x] << (cell * 4);
+                }
+                else
+                {
+                    key.high_ |= (uint64_t)this->points_[y][x] << ((cell - 16) * 4);
+                }
+            }
+        key.high_ |= (uint64_t)(this->characters_[0].y_ * W + this->characters_[0].x_) << 36;
+        key.high_ |= (uint64_t)(this->characters_[1].y_ * W + this->characters_[1].x_) << 41;
+        key.high_ |= (uint64_t)this->turn_ << 46;
+        return key;
+    }
+
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+    void advance(const int action)
+    {
+        auto &character = this->characters_[0];
+        character.x_ += dx[action];
+        character.y_ += dy[action];
+        auto &point = this->points_[character.y_][character.x_];
+        if (point > 0)
+        {
+            character.game_score_ += point;
+            point = 0;
+        }
+        this->turn_++;
+        std::swap(this->characters_[0], this->characters_[1]);
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        const auto &character = this->characters_[0];
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = character.y_ + dy[action];
+            int tx = character.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+            {
+                actions.emplace_back(action);
+            }
+        }
+        return actions;
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        if (isDone())
+        {
+            if (characters_[0].game_score_ > characters_[1].game_score_)
+                return WinningStatus::WIN;
+            else if (characters_[0].game_score_ < characters_[1].game_score_)
+                return WinningStatus::LOSE;
+            else
+                return WinningStatus::DRAW;
+        }
+        else
+        {
+            return WinningStatus::NONE;
+        }
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가한다.
+    ScoreType getScore() const
+    {
+        return characters_[0].game_score_ - characters_[1].game_score_;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+    double getFirstPlayerScoreForWinRate() const
+    {
+        switch (this->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            if (this->isFirstPlayer())
+            {
+                return 1.;
+            }
+            else
+            {
+                return 0.;
+            }
+        case (WinningStatus::LOSE):
+            if (this->isFirstPlayer())
+            {
+                return 0.;
+            }
+            else
+            {
+                return 1.;
+            }
+        default:
+            return 0.5;
+        }
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss("");
+        ss << "turn:\t" << this->turn_ << "\n";
+        for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+        {
+            int actual_player_id = player_id;
+            if (this->turn_ % 2 == 1)
+            {
+                actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+            }
+            const auto &chara = this->characters_[actual_player_id];
+            ss << "score(" << player_id << "):\t" << chara.game_score_ << "\ty: " << chara.y_ << " x: " << chara.x_ << "\n";
+        }
+        for (int h = 0; h < H; h++)
+        {
+            for (int w = 0; w < W; w++)
+            {
+                bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                {
+                    int actual_player_id = player_id;
+                    if (this->turn_ % 2 == 1)
+                    {
+                        actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                    }
+
+                    const auto &character = this->characters_[player_id];
+                    if (character.y_ == h && character.x_ == w)
+                    {
+                        if (actual_player_id == 0)
+                        {
+                            ss << 'A';
+                        }
+                        else
+                        {
+                            ss << 'B';
+                        }
+                        is_written = true;
+                    }
+                }
+                if (!is_written)
+                {
+                    if (this->points_[h][w] > 0)
+                    {
+                        ss << points_[h][w];
+                    }
+                    else
+                    {
+                        ss << '.';
+                    }
+                }
+            }
+            ss << '\n';
+        }
+
+        return ss.str();
+    }
+};
+
+using State = AlternateMazeState;
+
+// [테이블베이스] : tablebase::Key의 비트 배치에 들어가는지 확인한다.
+static_assert(H * W <= 25 && END_TURN < 16, "tablebase::Key does not fit the board");
+
+namespace iterativedeepening
+{
+    int64_t node_number = 0; // alphaBetaScore를 호출한 횟수
+
+    // 제한 시간이 넘으면 정지하는 알파-베타 가지치기용 점수 계산
+    ScoreType alphaBetaScore(const State &state, ScoreType alpha, const ScoreType beta, const int depth, const TimeKeeper &time_keeper)
+    {
+        ++node_number;
+        if (time_keeper.isTimeOver())
+            return 0;
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        auto legal_actions = state.legalActions();
+        if (legal_actions.empty())
+        {
+            return state.getScore();
+        }
+        for (const auto action : legal_actions)
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -beta, -alpha, depth - 1, time_keeper);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                alpha = score;
+            }
+            if (alpha >= beta)
+            {
+                return alpha;
+            }
+        }
+        return alpha;
+    }
+    // 깊이와 제한 시간(밀리초)을 지정해서 알파-베타 가지치기로 행동을 결정한다.
+    int alphaBetaActionWithTimeThreshold(const State &state, const int depth, const TimeKeeper &time_keeper)
+    {
+        ScoreType best_action = -1;
+        ScoreType alpha = -INF;
+        for (const auto action : state.legalActions())
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -INF, -alpha, depth, time_keeper);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                best_action = action;
+                alpha = score;
+            }
+        }
+        return best_action;
+    }
+
+    // 제한 시간(밀리초)을 지정해서 반복 심화 탐색으로 행동을 결정한다.
+    int iterativeDeepeningAction(const State &state, const int64_t time_threshold)
+    {
+        auto time_keeper = TimeKeeper(time_threshold);
+        int best_action = -1;
+        for (int depth = 1;; depth++)
+        {
+            int action = alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            else
+            {
+                best_action = action;
+            }
+        }
+        return best_action;
+    }
+}
+using iterativedeepening::iterativeDeepeningAction;
+
+// 무작위로 행동을 결정한다.
+int randomAction(const State &state)
+{
+    auto legal_actions = state.legalActions();
+    return legal_actions[mt_for_action() % (legal_actions.size())];
+}
+namespace montecarlo
+{
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(State *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state));
+            return 1. - playout(state);
+        }
+    }
+    // 플레이아웃 횟수를 지정해서 순수 몬테카를로 탐색으로 행동을 결정한다.
+    int primitiveMontecarloAction(const State &state, int playout_number)
+    {
+        auto legal_actions = state.legalActions();
+        auto values = std::vector<double>(legal_actions.size());
+        auto cnts = std::vector<double>(legal_actions.size());
+        for (int cnt = 0; cnt < playout_number; cnt++)
+        {
+            int index = cnt % legal_actions.size();
+
+            State next_state = state;
+            next_state.advance(legal_actions[index]);
+            values[index] += 1. - playout(&next_state);
+            ++cnts[index];
+        }
+        int best_action_index = -1;
+        double best_score = -INF;
+        for (int index = 0; index < legal_actions.size(); index++)
+        {
+            double value_mean = values[index] / cnts[index];
+            if (value_mean > best_score)
+            {
+                best_score = value_mean;
+                best_action_index = index;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+
+    constexpr const double C = 1.;             // UCB1 계산에 사용하는 상수
+    constexpr const int EXPAND_THRESHOLD = 10; // 노드를 확장하는 임계치
+
+    // MCTS 계산에 사용하는 노드
+    class Node
+    {
+    private:
+        State state_;
+        double w_;  // 누적 가치
+
+    public:
+        std::vector<Node> child_nodes_;
+        double n_;  // 시행 횟수
+
+        Node(const State &state) : state_(state), w_(0), n_(0) {}
+
+        // 노드를 평가한다.
+        double evaluate()
+        {
+            // 게임 종료시
+            if (this->state_.isDone())
+            {
+                double value = 0.5;
+                switch (this->state_.getWinningStatus())
+                {
+                case (WinningStatus::WIN):
+                    value = 1.;
+                    break;
+                case (WinningStatus::LOSE):
+                    value = 0.;
+                    break;
+                default:
+                    break;
+                }
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+            // 자식 노드가 존재하지 않는 경우
+            if (this->child_nodes_.empty())
+            {
+                State state_copy = this->state_;
+                double value = playout(&state_copy);
+                this->w_ += value;
+                ++this->n_;
+
+                if (this->n_ == EXPAND_THRESHOLD)
+                    this->expand();
+
+                return value;
+            }
+            // 자식 노드가 존재하는 경우
+            else
+            {
+                double value = 1. - this->nextChildNode().evaluate();
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+        }
+
+        // 노드를 확장한다.
+        void expand()
+        {
+            auto legal_actions = this->state_.legalActions();
+            this->child_nodes_.clear();
+            for (const auto action : legal_actions)
+            {
+                this->child_nodes_.emplace_back(this->state_);
+                this->child_nodes_.back().state_.advance(action);
+            }
+        }
+
+        // 어떤 노드를 평가할지 선택한다.
+        Node &nextChildNode()
+        {
+            for (auto &child_node : this->child_nodes_)
+            {
+                if (child_node.n_ == 0)
+                    return child_node;
+            }
+            double t = 0;
+            for (const auto &child_node : this->child_nodes_)
+            {
+                t += child_node.n_;
+            }
+            double best_value = -INF;
+            int best_action_index = -1;
+            for (int i = 0; i < this->child_nodes_.size(); i++)
+            {
+                const auto &child_node = this->child_nodes_[i];
+                double ucb1_value = 1. - child_node.w_ / child_node.n_ + (double)C * std::sqrt(2. * std::log(t) / child_node.n_);
+                if (ucb1_value > best_value)
+                {
+                    best_action_index = i;
+                    best_value = ucb1_value;
+                }
+            }
+            return this->child_nodes_[best_action_index];
+        }
+    };
+
+    // 플레이아웃 횟수를 지정해서 MCTS로 행동을 결정한다.
+    int mctsAction(const State &state, const int playout_number)
+    {
+        Node root_node = Node(state);
+        root_node.expand();
+        for (int i = 0; i < playout_number; i++)
+        {
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes_.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes_[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+}
+
+using montecarlo::mctsAction;
+
+namespace tablebase
+{
+    constexpr const char *FILE_PATH = "alternate_maze_tablebase.bin"; // 테이블베이스 파일
+    constexpr const char MAGIC[8] = "AMZTB01";                         // 파일 형식 확인용
+
+    // splitmix64의 마무리 단계로 키를 섞는다.
+    inline uint64_t mix(const Key &key)
+    {
+        uint64_t z = key.low_ ^ (key.high_ * 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const
+        {
+            return mix(key);
+        }
+    };
+
+    // 파일 앞부분에 기록하는 정보
+    struct Header
+    {
+        char magic_[8];
+        uint32_t h_;
+        uint32_t w_;
+        uint32_t end_turn_;
+        uint32_t min_remaining_turn_; // 기록한 게임판의 남은 턴 수의 최솟값
+        uint32_t max_remaining_turn_; // 기록한 게임판의 남은 턴 수의 최댓값
+        uint64_t capacity_;           // 칸 수(2의 거듭제곱)
+        uint64_t count_;              // 기록한 게임판 수
+    };
+
+    // 선형 탐사 해시 표의 칸 하나
+    // high_의 0~49번째 비트는 키, 55번째 비트는 사용 중 표시, 56~63번째 비트는 점수 차이(int8_t)
+    struct Slot
+    {
+        uint64_t low_;
+        uint64_t high_;
+    };
+    constexpr const uint64_t OCCUPIED_BIT = 1ULL << 55;
+    constexpr const uint64_t KEY_HIGH_MASK = (1ULL << 50) - 1;
+
+    // 남은 턴이 max_remaining_turn 이하인 게임판을 게임 종료 쪽부터 풀어서 파일로 기록하는 오프라인 도구
+    // 모든 바닥 배치를 나열할 수는 없으므로, 지정한 seed의 초기 게임판에서 도달할 수 있는 게임판만 기록한다.
+    // 바닥 배치는 seed마다 다르므로 기록하지 않은 seed의 게임판은 거의 찾을 수 없다.
+    // 게임판 수는 남은 턴이 적을수록 많지만 탐색으로 금방 풀리므로, 남은 턴이 min_remaining_turn 이상인 게임판만 파일에 기록한다.
+    class TablebaseBuilder
+    {
+    private:
+        int min_remaining_turn_;
+        int max_remaining_turn_;
+        std::unordered_map<Key, int8_t, KeyHash> values_;
+
+        // 현재 플레이어 시점에서 지금부터 게임 종료까지 얻는 점수 차이를 양쪽 모두 최선을 다한다고 가정해서 계산한다.
+        // 미니맥스 점수는 state.getScore()에 이 값을 더한 값이다.
+        int solve(const State &state)
+        {
+            if (state.isDone())
+            {
+                return 0;
+            }
+            const auto key = state.tablebaseKey();
+            auto itr = this->values_.find(key);
+            if (itr != this->values_.end())
+            {
+                return itr->second;
+            }
+            int best_value = -INF;
+            for (const auto action : state.legalActions())
+            {
+                State next_state = state;
+                next_state.advance(action);
+                const int value = -(next_state.getScore() + solve(next_state)) - state.getScore();
+                if (value > best_value)
+                {
+                    best_value = value;
+                }
+            }
+            this->values_.emplace(key, (int8_t)best_value);
+            return best_value;
+        }
+
+        // 남은 턴이 max_remaining_turn_이 될 때까지 모든 행동으로 진행해서 나온 게임판을 푼다.
+        void enumerate(const State &state)
+        {
+            if (state.remainingTurn() <= this->max_remaining_turn_)
+            {
+                solve(state);
+                return;
+            }
+            for (const auto action : state.legalActions())
+            {
+                State next_state = state;
+                next_state.advance(action);
+                enumerate(next_state);
+            }
+        }
+
+    public:
+        TablebaseBuilder(const int min_remaining_turn, const int max_remaining_turn)
+            : min_remaining_turn_(min_remaining_turn), max_remaining_turn_(max_remaining_turn)
+        {
+            assert(9 * max_remaining_turn <= INT8_MAX);
+        }
+
+        // seed로 만든 초기 게임판에서 도달할 수 있는 게임판을 추가한다.
+        void addSeed(const int seed)
+        {
+            enumerate(State(seed));
+        }
+
+        // key에 부호화된 턴에서 남은 턴 수를 계산한다.
+        static int remainingTurn(const Key &key)
+        {
+            return END_TURN - (int)((key.high_ >> 46) & 15);
+        }
+
+        // 파일에 기록할 게임판 수
+        size_t size() const
+        {
+            size_t count = 0;
+            for (const auto &key_value : this->values_)
+            {
+                if (remainingTurn(key_value.first) >= this->min_remaining_turn_)
+                {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        // 사용률이 1/2 이하인 선형 탐사 해시 표로 만들어서 path에 기록한다. 기록한 바이트 수를 돌려주고, 실패하면 0을 돌려준다.
+        size_t write(const std::string &path) const
+        {
+            const size_t count = this->size();
+            uint64_t capacity = 1;
+            while (capacity < count * 2)
+            {
+                capacity <<= 1;
+            }
+            std::vector<Slot> slots(capacity, Slot{0, 0});
+            for (const auto &key_value : this->values_)
+            {
+                const auto &key = key_value.first;
+                if (remainingTurn(key) < this->min_remaining_turn_)
+                {
+                    continue;
+                }
+                uint64_t index = mix(key) & (capacity - 1);
+                while (slots[index].high_ & OCCUPIED_BIT)
+                {
+                    index = (index + 1) & (capacity - 1);
+                }
+                slots[index].low_ = key.low_;
+                slots[index].high_ = key.high_ | OCCUPIED_BIT | ((uint64_t)(uint8_t)key_value.second << 56);
+            }
+            Header header = {};
+            std::memcpy(header.magic_, MAGIC, sizeof(MAGIC));
+            header.h_ = H;
+            header.w_ = W;
+            header.end_turn_ = END_TURN;
+            header.min_remaining_turn_ = this->min_remaining_turn_;
+            header.max_remaining_turn_ = this->max_remaining_turn_;
+            header.capacity_ = capacity;
+            header.count_ = count;
+
+            std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+            ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            ofs.write(reinterpret_cast<const char *>(slots.data()), sizeof(Slot) * capacity);
+            if (!ofs)
+            {
+                return 0;
+            }
+            return sizeof(header) + sizeof(Slot) * capacity;
+        }
+    };
+
+    // 테이블베이스 파일을 메모리에 매핑해서 게임판 하나를 O(1)로 조회한다.
+    // 읽기 전용으로 매핑하므로 여러 프로세스가 같은 파일을 열어도 물리 메모리를 공유한다.
+    class Tablebase
+    {
+    private:
+        int fd_ = -1;
+        void *address_ = nullptr;
+        size_t length_ = 0;
+        const Header *header_ = nullptr;
+        const Slot *slots_ = nullptr;
+        uint64_t mask_ = 0;
+
+    public:
+        int64_t probe_number_ = 0; // 조회한 횟수
+        int64_t hit_number_ = 0;   // 기록되어 있었던 횟수
+
+        Tablebase() = default;
+        Tablebase(const Tablebase &) = delete;
+        Tablebase &operator=(const Tablebase &) = delete;
+        ~Tablebase()
+        {
+            this->close();
+        }
+
+        // path의 파일을 매핑한다. 파일이 없거나 게임 설정이 다르면 false를 돌려준다.
+        bool open(const std::string &path)
+        {
+            this->close();
+            this->fd_ = ::open(path.c_str(), O_RDONLY);
+            if (this->fd_ < 0)
+            {
+                return false;
+            }
+            struct stat file_stat;
+            if (fstat(this->fd_, &file_stat) != 0 || (size_t)file_stat.st_size < sizeof(Header))
+            {
+                this->close();
+                return false;
+            }
+            this->length_ = file_stat.st_size;
+            void *address = mmap(nullptr, this->length_, PROT_READ, MAP_SHARED, this->fd_, 0);
+            if (address == MAP_FAILED)
+            {
+                this->close();
+                return false;
+            }
+            this->address_ = address;
+            this->header_ = static_cast<const Header *>(address);
+            const auto &header = *this->header_;
+            if (std::memcmp(header.magic_, MAGIC, sizeof(MAGIC)) != 0 ||
+                header.h_ != H || header.w_ != W || header.end_turn_ != END_TURN ||
+                this->length_ != sizeof(Header) + sizeof(Slot) * header.capacity_)
+            {
+                this->close();
+                return false;
+            }
+            this->slots_ = reinterpret_cast<const Slot *>(static_cast<const char *>(address) + sizeof(Header));
+            this->mask_ = header.capacity_ - 1;
+            return true;
+        }
+
+        void close()
+        {
+            if (this->address_ != nullptr)
+            {
+                munmap(this->address_, this->length_);
+            }
+            if (this->fd_ >= 0)
+            {
+                ::close(this->fd_);
+            }
+            this->fd_ = -1;
+            this->address_ = nullptr;
+            this->length_ = 0;
+            this->header_ = nullptr;
+            this->slots_ = nullptr;
+            this->mask_ = 0;
+        }
+
+        bool isOpen() const
+        {
+            return this->slots_ != nullptr;
+        }
+
+        // state가 기록되어 있으면 현재 플레이어 시점에서 게임 종료까지 얻는 점수 차이를 value에 기록하고 true를 돌려준다.
+        bool probe(const State &state, int &value)
+        {
+            if (!this->isOpen() ||
+                state.remainingTurn() < (int)this->header_->min_remaining_turn_ ||
+                state.remainingTurn() > (int)this->header_->max_remaining_turn_)
+            {
+                return false;
+            }
+            ++this->probe_number_;
+            const auto key = state.tablebaseKey();
+            for (uint64_t index = mix(key) & this->mask_;; index = (index + 1) & this->mask_)
+            {
+                const auto &slot = this->slots_[index];
+                if (!(slot.high_ & OCCUPIED_BIT))
+                {
+                    return false;
+                }
+                if (slot.low_ == key.low_ && (slot.high_ & KEY_HIGH_MASK) == key.high_)
+                {
+                    value = (int8_t)(slot.high_ >> 56);
+                    ++this->hit_number_;
+                    return true;
+                }
+            }
+        }
+    };
+
+    Tablebase endgame_table; // 탐색에서 조회하는 테이블베이스
+}
+
+namespace tablebase_search
+{
+    int64_t node_number = 0; // alphaBetaScore를 호출한 횟수
+
+    // 제한 시간이 넘으면 정지하는 알파-베타 가지치기용 점수 계산
+    // 테이블베이스에 있는 게임판은 남은 부분 트리 전체를 한 번의 조회로 대신한다.
+    ScoreType alphaBetaScore(const State &state, ScoreType alpha, const ScoreType beta, const int depth, const TimeKeeper &time_keeper)
+    {
+        ++node_number;
+        if (time_keeper.isTimeOver())
+            return 0;
+        int value;
+        if (tablebase::endgame_table.probe(state, value))
+        {
+            return state.getScore() + value;
+        }
+        if (state.isDone() || depth == 0)
+        {
+            return state.getScore();
+        }
+        auto legal_actions = state.legalActions();
+        if (legal_actions.empty())
+        {
+            return state.getScore();
+        }
+        for (const auto action : legal_actions)
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -beta, -alpha, depth - 1, time_keeper);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                alpha = score;
+            }
+            if (alpha >= beta)
+            {
+                return alpha;
+            }
+        }
+        return alpha;
+    }
+    // 깊이와 제한 시간(밀리초)을 지정해서 알파-베타 가지치기로 행동을 결정한다.
+    int alphaBetaActionWithTimeThreshold(const State &state, const int depth, const TimeKeeper &time_keeper)
+    {
+        ScoreType best_action = -1;
+        ScoreType alpha = -INF;
+        for (const auto action : state.legalActions())
+        {
+            State next_state = state;
+            next_state.advance(action);
+            ScoreType score = -alphaBetaScore(next_state, -INF, -alpha, depth, time_keeper);
+            if (time_keeper.isTimeOver())
+                return 0;
+            if (score > alpha)
+            {
+                best_action = action;
+                alpha = score;
+            }
+        }
+        return best_action;
+    }
+
+    // 제한 시간(밀리초)을 지정해서 반복 심화 탐색으로 행동을 결정한다.
+    int iterativeDeepeningAction(const State &state, const int64_t time_threshold)
+    {
+        auto time_keeper = TimeKeeper(time_threshold);
+        int best_action = -1;
+        for (int depth = 1;; depth++)
+        {
+            int action = alphaBetaActionWithTimeThreshold(state, depth, time_keeper);
+
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            else
+            {
+                best_action = action;
+            }
+        }
+        return best_action;
+    }
+}
+
+namespace tablebase_montecarlo
+{
+    using montecarlo::C;
+    using montecarlo::EXPAND_THRESHOLD;
+    using montecarlo::playout;
+
+    // 현재 플레이어 시점의 최종 점수 차이를 승패 가치로 바꾼다.
+    double scoreToValue(const ScoreType score)
+    {
+        if (score > 0)
+        {
+            return 1.;
+        }
+        else if (score < 0)
+        {
+            return 0.;
+        }
+        return 0.5;
+    }
+
+    // MCTS 계산에 사용하는 노드
+    // 테이블베이스에 있는 게임판은 플레이아웃 대신 정확한 승패를 사용하고, 확장하지 않는다.
+    class Node
+    {
+    private:
+        State state_;
+        double w_; // 누적 가치
+
+    public:
+        std::vector<Node> child_nodes_;
+        double n_; // 시행 횟수
+
+        Node(const State &state) : state_(state), w_(0), n_(0) {}
+
+        // 노드를 평가한다.
+        double evaluate()
+        {
+            // 게임 종료시
+            if (this->state_.isDone())
+            {
+                double value = 0.5;
+                switch (this->state_.getWinningStatus())
+                {
+                case (WinningStatus::WIN):
+                    value = 1.;
+                    break;
+                case (WinningStatus::LOSE):
+                    value = 0.;
+                    break;
+                default:
+                    break;
+                }
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+            // 자식 노드가 존재하지 않는 경우
+            if (this->child_nodes_.empty())
+            {
+                int score;
+                if (tablebase::endgame_table.probe(this->state_, score))
+                {
+                    double value = scoreToValue(this->state_.getScore() + score);
+                    this->w_ += value;
+                    ++this->n_;
+                    return value;
+                }
+                State state_copy = this->state_;
+                double value = playout(&state_copy);
+                this->w_ += value;
+                ++this->n_;
+
+                if (this->n_ == EXPAND_THRESHOLD)
+                    this->expand();
+
+                return value;
+            }
+            // 자식 노드가 존재하는 경우
+            else
+            {
+                double value = 1. - this->nextChildNode().evaluate();
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+        }
+
+        // 노드를 확장한다.
+        void expand()
+        {
+            auto legal_actions = this->state_.legalActions();
+            this->child_nodes_.clear();
+            for (const auto action : legal_actions)
+            {
+                this->child_nodes_.emplace_back(this->state_);
+                this->child_nodes_.back().state_.advance(action);
+            }
+        }
+
+        // 어떤 노드를 평가할지 선택한다.
+        Node &nextChildNode()
+        {
+            for (auto &child_node : this->child_nodes_)
+            {
+                if (child_node.n_ == 0)
+                    return child_node;
+            }
+            double t = 0;
+            for (const auto &child_node : this->child_nodes_)
+            {
+                t += child_node.n_;
+            }
+            double best_value = -INF;
+            int best_action_index = -1;
+            for (int i = 0; i < this->child_nodes_.size(); i++)
+            {
+                const auto &child_node = this->child_nodes_[i];
+                double ucb1_value = 1. - child_node.w_ / child_node.n_ + (double)C * std::sqrt(2. * std::log(t) / child_node.n_);
+                if (ucb1_value > best_value)
+                {
+                    best_action_index = i;
+                    best_value = ucb1_value;
+                }
+            }
+            return this->child_nodes_[best_action_index];
+        }
+    };
+
+    // 플레이아웃 횟수를 지정해서 테이블베이스를 조회하는 MCTS로 행동을 결정한다.
+    int mctsAction(const State &state, const int playout_number)
+    {
+        Node root_node = Node(state);
+        root_node.expand();
+        for (int i = 0; i < playout_number; i++)
+        {
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes_.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes_[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+}
+
+
+using AIFunction = std::function<int(const State &)>;
+using StringAIPair = std::pair<std::string, AIFunction>;
+
+// 게임을 game_number×2(선공과 후공을 교대)횟수만큼 플레이해서 ais의 0번째에 있는 AI 승률을 표시한다.
+// 초기 게임판은 seed first_seed~first_seed+game_number-1로 만든다.
+void testFirstPlayerWinRate(const std::array<StringAIPair, 2> &ais, const int game_number, const int first_seed = 0)
+{
+    using std::cout;
+    using std::endl;
+
+    double first_player_win_rate = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto base_state = State(first_seed + i);
+        for (int j = 0; j < 2; j++)
+        { // 공평하게 선공과 후공을 교대함
+            auto state = base_state;
+            auto &first_ai = ais[j];
+            auto &second_ai = ais[(j + 1) % 2];
+            while (true)
+            {
+                state.advance(first_ai.second(state));
+                if (state.isDone())
+                    break;
+                state.advance(second_ai.second(state));
+                if (state.isDone())
+                    break;
+            }
+            double win_rate_point = state.getFirstPlayerScoreForWinRate();
+            if (j == 1)
+                win_rate_point = 1 - win_rate_point;
+            if (win_rate_point >= 0)
+            {
+                state.toString();
+            }
+            first_player_win_rate += win_rate_point;
+        }
+        cout << "i " << i << " w " << first_player_win_rate / ((i + 1) * 2) << endl;
+    }
+    first_player_win_rate /= (double)(game_number * 2);
+    cout << "Winning rate of " << ais[0].first << " to " << ais[1].first << ":\t" << first_player_win_rate << endl;
+}
+
+// seed first_seed~first_seed+game_number-1의 초기 게임판을 무작위로 진행해서 여러 턴의 게임판을 만든다.
+std::vector<State> getSampleStates(const int game_number, const int first_seed = 0)
+{
+    std::mt19937 mt_for_sample(0);
+    std::vector<State> states;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(first_seed + i);
+        int turn = mt_for_sample() % END_TURN;
+        for (int t = 0; t < turn; t++)
+        {
+            auto legal_actions = state.legalActions();
+            state.advance(legal_actions[mt_for_sample() % legal_actions.size()]);
+        }
+        states.emplace_back(state);
+    }
+    return states;
+}
+
+// 게임판이 테이블베이스에 있는 비율과, 있으면 그 값이 알파-베타 가지치기로 게임 종료까지 읽은 값과 같은지 확인한다.
+void testTablebaseValue(const std::vector<State> &states)
+{
+    using std::cout;
+    using std::endl;
+    auto time_keeper = TimeKeeper(INF);
+    int probe_number = 0;
+    int same_number = 0;
+    for (const auto &state : states)
+    {
+        int value;
+        if (!tablebase::endgame_table.probe(state, value))
+        {
+            continue;
+        }
+        ++probe_number;
+        same_number += state.getScore() + value == iterativedeepening::alphaBetaScore(state, -INF, INF, state.remainingTurn(), time_keeper);
+    }
+    cout << "tablebase hit " << probe_number << " / " << states.size() << "\tvalue same " << same_number << " / " << probe_number << endl;
+}
+
+// 게임 종료까지 읽는 알파-베타 가지치기의 시간, 노드 수, 고른 행동을 테이블베이스 유무로 비교한다.
+void testAlphaBeta(const std::vector<State> &states)
+{
+    using std::cout;
+    using std::endl;
+    auto time_keeper = TimeKeeper(INF);
+    std::vector<int> actions;
+    iterativedeepening::node_number = 0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (const auto &state : states)
+    {
+        actions.emplace_back(iterativedeepening::alphaBetaActionWithTimeThreshold(state, state.remainingTurn(), time_keeper));
+    }
+    auto diff = std::chrono::high_resolution_clock::now() - start_time;
+    cout << "alphaBetaAction\t" << std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() << " ms\t" << iterativedeepening::node_number << " nodes" << endl;
+
+    int same_number = 0;
+    tablebase_search::node_number = 0;
+    start_time = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < states.size(); i++)
+    {
+        same_number += tablebase_search::alphaBetaActionWithTimeThreshold(states[i], states[i].remainingTurn(), time_keeper) == actions[i];
+    }
+    diff = std::chrono::high_resolution_clock::now() - start_time;
+    cout << "tablebase_search::alphaBetaAction\t" << std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() << " ms\t" << tablebase_search::node_number << " nodes\tsame action " << same_number << " / " << states.size() << endl;
+}
+
+int main()
+{
+    using std::cout;
+    using std::endl;
+    constexpr const int MIN_REMAINING_TURN = 5; // 테이블베이스에 기록하는 남은 턴 수의 최솟값
+    constexpr const int MAX_REMAINING_TURN = 6; // 테이블베이스에 기록하는 남은 턴 수의 최댓값
+    constexpr const int SEED_NUMBER = 100;      // 테이블베이스를 만들 때 사용하는 seed 수
+    constexpr const int HELD_OUT_SEED = 1000;   // 테이블베이스에 넣지 않은 seed의 시작 번호
+
+    // 파일이 없을 때만 테이블베이스를 만든다.
+    if (!tablebase::endgame_table.open(tablebase::FILE_PATH))
+    {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        auto builder = tablebase::TablebaseBuilder(MIN_REMAINING_TURN, MAX_REMAINING_TURN);
+        for (int seed = 0; seed < SEED_NUMBER; seed++)
+        {
+            builder.addSeed(seed);
+        }
+        const size_t bytes = builder.write(tablebase::FILE_PATH);
+        auto diff = std::chrono::high_resolution_clock::now() - start_time;
+        cout << "tablebase " << builder.size() << " positions\t" << bytes << " bytes\t" << std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() << " ms" << endl;
+        if (!tablebase::endgame_table.open(tablebase::FILE_PATH))
+        {
+            cout << "failed to open " << tablebase::FILE_PATH << endl;
+            return 1;
+        }
+    }
+
+    auto ais = std::array<StringAIPair, 2>{
+        StringAIPair("tablebase_montecarlo::mctsAction 1000", [](const State &state)
+                     { return tablebase_montecarlo::mctsAction(state, 1000); }),
+        StringAIPair("mctsAction 1000", [](const State &state)
+                     { return mctsAction(state, 1000); }),
+    };
+
+    // 테이블베이스를 만든 seed에서의 결과
+    cout << "seed 0-" << SEED_NUMBER - 1 << " (in tablebase)" << endl;
+    auto states = getSampleStates(SEED_NUMBER);
+    testTablebaseValue(states);
+    testAlphaBeta(states);
+    testFirstPlayerWinRate(ais, 100);
+
+    // 테이블베이스에 없는 seed에서의 결과. 실제로 기대할 수 있는 적중률과 효과는 이쪽이다.
+    cout << "seed " << HELD_OUT_SEED << "-" << HELD_OUT_SEED + SEED_NUMBER - 1 << " (held out)" << endl;
+    states = getSampleStates(SEED_NUMBER, HELD_OUT_SEED);
+    testTablebaseValue(states);
+    testAlphaBeta(states);
+    testFirstPlayerWinRate(ais, 100, HELD_OUT_SEED);
+
+    return 0;
+}
@@ -0,0 +1,555 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <array>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+#include <queue>
+#include <set>
+#include <numeric>
+#pragma GCC diagnostic ignored "-Wsign-compare"
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+constexpr const int H = 5;   // 미로의 높이
+constexpr const int W = 5;   // 미로의 너비
+constexpr int END_TURN = 10; // 게임 종료 턴
+
+using ScoreType = int64_t;
+constexpr const ScoreType INF = 1000000000LL;
+
+enum WinningStatus
+{
+    WIN,
+    LOSE,
+    DRAW,
+    NONE,
+};
+
+class AlternateMazeState
+{
+private:
+    static constexpr const int dx[4] = {1, -1, 0, 0};
+    static constexpr const int dy[4] = {0, 0, 1, -1};
+    struct Character
+    {
+        int y_;
+        int x_;
+        int game_score_;
+        Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+    };
+    std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+    int turn_;                             // 현재 턴
+    std::vector<Character> characters_;
+
+    // 현재 플레이어가 선공인지 판정한다.
+    bool isFirstPlayer() const
+    {
+        return this->turn_ % 2 == 0;
+    }
+
+public:
+    AlternateMazeState(const int seed) : points_(H, std::vector<int>(W)),
+                                         turn_(0),
+                                         characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+    {
+        auto mt_for_construct = std::mt19937(seed);
+
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                int point = mt_for_construct() % 10;
+                if (characters_[0].y_ == y && characters_[0].x_ == x)
+                {
+                    continue;
+                }
+                if (characters_[1].y_ == y && characters_[1].x_ == x)
+                {
+                    continue;
+                }
+
+                this->points_[y][x] = point;
+            }
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return this->turn_ == END_TURN;
+    }
+
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+    void advance(const int action)
+    {
+        auto &character = this->characters_[0];
+        character.x_ += dx[action];
+        character.y_ += dy[action];
+        auto &point = this->points_[character.y_][character.x_];
+        if (point > 0)
+        {
+            character.game_score_ += point;
+            point = 0;
+        }
+        this->turn_++;
+        std::swap(this->characters_[0], this->characters_[1]);
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        const auto &character = this->characters_[0];
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = character.y_ + dy[action];
+            int tx = character.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+            {
+                actions.emplace_back(action);
+            }
+        }
+        return actions;
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        if (isDone())
+        {
+            if (characters_[0].game_score_ > characters_[1].game_score_)
+                return WinningStatus::WIN;
+            else if (characters_[0].game_score_ < characters_[1].game_score_)
+                return WinningStatus::LOSE;
+            else
+                return WinningStatus::DRAW;
+        }
+        else
+        {
+            return WinningStatus::NONE;
+        }
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가한다.
+    ScoreType getScore() const
+    {
+        return characters_[0].game_score_ - characters_[1].game_score_;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+    double getFirstPlayerScoreForWinRate() const
+    {
+        switch (this->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            if (this->isFirstPlayer())
+            {
+                return 1.;
+            }
+            else
+            {
+                return 0.;
+            }
+        case (WinningStatus::LOSE):
+            if (this->isFirstPlayer())
+            {
+                return 0.;
+            }
+            else
+            {
+                return 1.;
+            }
+        default:
+            return 0.5;
+        }
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss("");
+        ss << "turn:\t" << this->turn_ << "\n";
+        for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+        {
+            int actual_player_id = player_id;
+            if (this->turn_ % 2 == 1)
+            {
+                actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+            }
+            const auto &chara = this->characters_[actual_player_id];
+            ss << "score(" << player_id << "):\t" << chara.game_score_ << "\ty: " << chara.y_ << " x: " << chara.x_ << "\n";
+        }
+        for (int h = 0; h < H; h++)
+        {
+            for (int w = 0; w < W; w++)
+            {
+                bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                {
+                    int actual_player_id = player_id;
+                    if (this->turn_ % 2 == 1)
+                    {
+                        actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                    }
+
+                    const auto &character = this->characters_[player_id];
+                    if (character.y_ == h && character.x_ == w)
+                    {
+                        if (actual_player_id == 0)
+                        {
+                            ss << 'A';
+                        }
+                        else
+                        {
+                            ss << 'B';
+                        }
+                        is_written = true;
+                    }
+                }
+                if (!is_written)
+                {
+                    if (this->points_[h][w] > 0)
+                    {
+                        ss << points_[h][w];
+                    }
+                    else
+                    {
+                        ss << '.';
+                    }
+                }
+            }
+            ss << '\n';
+        }
+
+        return ss.str();
+    }
+};
+
+using State = AlternateMazeState;
+
+// 무작위로 행동을 결정한다.
+int randomAction(const State &state)
+{
+    auto legal_actions = state.legalActions();
+    return legal_actions[mt_for_action() % (legal_actions.size())];
+}
+namespace montecarlo
+{
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(State *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state));
+            return 1. - playout(state);
+        }
+    }
+    // 플레이아웃 횟수를 지정해서 순수 몬테카를로 탐색으로 행동을 결정한다.
+    int primitiveMontecarloAction(const State &state, int playout_number)
+    {
+        auto legal_actions = state.legalActions();
+        auto values = std::vector<double>(legal_actions.size());
+        auto cnts = std::vector<double>(legal_actions.size());
+        for (int cnt = 0; cnt < playout_number; cnt++)
+        {
+            int index = cnt % legal_actions.size();
+
+            State next_state = state;
+            next_state.advance(legal_actions[index]);
+            values[index] += 1. - playout(&next_state);
+            ++cnts[index];
+        }
+        int best_action_index = -1;
+        double best_score = -INF;
+        for (int index = 0; index < legal_actions.size(); index++)
+        {
+            double value_mean = values[index] / cnts[index];
+            if (value_mean > best_score)
+            {
+                best_score = value_mean;
+                best_action_index = index;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+}
+
+using montecarlo::primitiveMontecarloAction;
+
+namespace adaptive
+{
+    using montecarlo::playout;
+
+    // legal_actions[index]로 진행한 다음 플레이아웃해서 현재 플레이어 시점의 가치를 돌려준다.
+    double playoutAction(const State &state, const std::vector<int> &legal_actions, const int index)
+    {
+        State next_state = state;
+        next_state.advance(legal_actions[index]);
+        return 1. - playout(&next_state);
+    }
+
+    // 플레이아웃 횟수를 지정해서 successive halving으로 행동을 결정한다.
+    // 라운드마다 남은 후보에게 플레이아웃을 똑같이 나누고, 평균 가치가 낮은 절반을 후보에서 뺀다.
+    int successiveHalvingAction(const State &state, const int playout_number)
+    {
+        auto legal_actions = state.legalActions();
+        const int action_number = legal_actions.size();
+        auto values = std::vector<double>(action_number);
+        auto cnts = std::vector<double>(action_number);
+        auto candidates = std::vector<int>(action_number);
+        std::iota(candidates.begin(), candidates.end(), 0);
+
+        int round_number = 0;
+        for (int k = action_number; k > 1; k = (k + 1) / 2)
+        {
+            ++round_number;
+        }
+        // 한 번도 플레이아웃하지 못한 후보는 평균 가치를 정할 수 없으므로 가장 낮게 취급한다.
+        auto value_mean = [&](const int index)
+        { return cnts[index] == 0 ? -1. : values[index] / cnts[index]; };
+        int playout_count = 0;
+        for (int round = 0; round < round_number; round++)
+        {
+            // 남은 플레이아웃을 남은 라운드에 똑같이 나눈다. 마지막 라운드에는 나머지를 모두 쓴다.
+            const int round_playout_number = (playout_number - playout_count) / (round_number - round);
+            const int candidate_number = candidates.size();
+            for (int order = 0; order < candidate_number; order++)
+            {
+                // 후보에게 나누고 남은 만큼은 앞쪽 후보부터 1회씩 더 준다.
+                const int candidate_playout_number = round_playout_number / candidate_number + (order < round_playout_number % candidate_number ? 1 : 0);
+                const int index = candidates[order];
+                for (int i = 0; i < candidate_playout_number; i++)
+                {
+                    values[index] += playoutAction(state, legal_actions, index);
+                    ++cnts[index];
+                    ++playout_count;
+                }
+            }
+            std::stable_sort(candidates.begin(), candidates.end(), [&](const int a, const int b)
+                             { return value_mean(a) > value_mean(b); });
+            candidates.resize((candidates.size() + 1) / 2);
+        }
+        return legal_actions[candidates[0]];
+    }
+
+    constexpr const double C = 1.; // UCB1 계산에 사용하는 상수
+
+    // 플레이아웃 횟수를 지정해서 루트에서 UCB1로 플레이아웃을 나누고, 가장 많이 플레이아웃한 행동을 고른다.
+    int ucbAction(const State &state, const int playout_number)
+    {
+        auto legal_actions = state.legalActions();
+        const int action_number = legal_actions.size();
+        auto values = std::vector<double>(action_number);
+        auto cnts = std::vector<double>(action_number);
+        for (int cnt = 0; cnt < playout_number; cnt++)
+        {
+            int index = cnt;
+            if (cnt >= action_number)
+            {
+                double best_value = -INF;
+                for (int i = 0; i < action_number; i++)
+                {
+                    double ucb1_value = values[i] / cnts[i] + C * std::sqrt(2. * std::log(cnt) / cnts[i]);
+                    if (ucb1_value > best_value)
+                    {
+                        best_value = ucb1_value;
+                        index = i;
+                    }
+                }
+            }
+            values[index] += playoutAction(state, legal_actions, index);
+            ++cnts[index];
+        }
+        int best_action_index = 0;
+        for (int index = 1; index < action_number; index++)
+        {
+            if (cnts[index] > cnts[best_action_index])
+            {
+                best_action_index = index;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+}
+
+using AIFunction = std::function<int(const State &)>;
+using StringAIPair = std::pair<std::string, AIFunction>;
+
+// 게임을 game_number×2(선공과 후공을 교대)횟수만큼 플레이해서 ais의 0번째에 있는 AI 승률을 표시한다.
+void testFirstPlayerWinRate(const std::array<StringAIPair, 2> &ais, const int game_number)
+{
+    using std::cout;
+    using std::endl;
+
+    double first_player_win_rate = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto base_state = State(i);
+        for (int j = 0; j < 2; j++)
+        { // 공평하게 선공과 후공을 교대함
+            auto state = base_state;
+            auto &first_ai = ais[j];
+            auto &second_ai = ais[(j + 1) % 2];
+            while (true)
+            {
+                state.advance(first_ai.second(state));
+                if (state.isDone())
+                    break;
+                state.advance(second_ai.second(state));
+                if (state.isDone())
+                    break;
+            }
+            double win_rate_point = state.getFirstPlayerScoreForWinRate();
+            if (j == 1)
+                win_rate_point = 1 - win_rate_point;
+            if (win_rate_point >= 0)
+            {
+                state.toString();
+            }
+            first_player_win_rate += win_rate_point;
+        }
+        cout << "i " << i << " w " << first_player_win_rate / ((i + 1) * 2) << endl;
+    }
+    first_player_win_rate /= (double)(game_number * 2);
+    cout << "Winning rate of " << ais[0].first << " to " << ais[1].first << ":\t" << first_player_win_rate << endl;
+}
+
+// 게임판을 무작위로 진행해서 여러 턴의 게임판을 만든다.
+std::vector<State> getSampleStates(const int game_number)
+{
+    std::mt19937 mt_for_sample(0);
+    std::vector<State> states;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(mt_for_sample());
+        int turn = mt_for_sample() % END_TURN;
+        for (int t = 0; t < turn; t++)
+        {
+            auto legal_actions = state.legalActions();
+            state.advance(legal_actions[mt_for_sample() % legal_actions.size()]);
+        }
+        states.emplace_back(state);
+    }
+    return states;
+}
+
+// 행동마다 playout_number회 플레이아웃한 평균 가치를 계산한다.
+std::vector<double> getReferenceValues(const State &state, const int playout_number)
+{
+    auto legal_actions = state.legalActions();
+    auto values = std::vector<double>(legal_actions.size());
+    for (int index = 0; index < legal_actions.size(); index++)
+    {
+        for (int i = 0; i < playout_number; i++)
+        {
+            values[index] += adaptive::playoutAction(state, legal_actions, index);
+        }
+        values[index] /= playout_number;
+    }
+    return values;
+}
+
+// 플레이아웃 횟수마다 각 방법이 기준(행동마다 reference_playout_number회 플레이아웃)과 같은 행동을 고른 비율과,
+// 고른 행동의 기준 가치가 최선의 행동보다 낮은 정도의 평균(손실)을 표시한다.
+void testDecisionAgreement(const std::vector<State> &states, const std::vector<int> &playout_numbers, const int reference_playout_number)
+{
+    using std::cout;
+    using std::endl;
+    using PlayoutAIFunction = std::function<int(const State &, const int)>;
+    const std::vector<std::pair<std::string, PlayoutAIFunction>> ais = {
+        {"round-robin", montecarlo::primitiveMontecarloAction},
+        {"successive halving", adaptive::successiveHalvingAction},
+        {"ucb", adaptive::ucbAction},
+    };
+    std::vector<std::vector<double>> reference_values;
+    std::vector<int> reference_actions;
+    for (const auto &state : states)
+    {
+        auto legal_actions = state.legalActions();
+        reference_values.emplace_back(getReferenceValues(state, reference_playout_number));
+        const auto &values = reference_values.back();
+        reference_actions.emplace_back(legal_actions[std::max_element(values.begin(), values.end()) - values.begin()]);
+    }
+    cout << "playout";
+    for (const auto &ai : ais)
+    {
+        cout << "\t" << ai.first << "(same, loss)";
+    }
+    cout << endl;
+    for (const auto playout_number : playout_numbers)
+    {
+        cout << playout_number;
+        for (const auto &ai : ais)
+        {
+            int same_number = 0;
+            double loss = 0;
+            for (int i = 0; i < states.size(); i++)
+            {
+                auto legal_actions = states[i].legalActions();
+                const int action = ai.second(states[i], playout_number);
+                same_number += action == reference_actions[i];
+                const auto &values = reference_values[i];
+                loss += *std::max_element(values.begin(), values.end()) - values[std::find(legal_actions.begin(), legal_actions.end(), action) - legal_actions.begin()];
+            }
+            cout << "\t" << (double)same_number / states.size() << ", " << loss / states.size();
+        }
+        cout << endl;
+    }
+}
+
+int main()
+{
+    testDecisionAgreement(getSampleStates(500), {10, 30, 100, 300, 1000, 3000}, 20000);
+
+    auto ais = std::array<StringAIPair, 2>{
+        StringAIPair("successiveHalvingAction 100", [](const State &state)
+                     { return adaptive::successiveHalvingAction(state, 100); }),
+        StringAIPair("primitiveMontecarloAction 100", [](const State &state)
+                     { return montecarlo::primitiveMontecarloAction(state, 100); }),
+    };
+    testFirstPlayerWinRate(ais, 100);
+    ais = std::array<StringAIPair, 2>{
+        StringAIPair("ucbAction 100", [](const State &state)
+                     { return adaptive::ucbAction(state, 100); }),
+        StringAIPair("primitiveMontecarloAction 100", [](const State &state)
+                     { return montecarlo::primitiveMontecarloAction(state, 100); }),
+    };
+    testFirstPlayerWinRate(ais, 100);
+    return 0;
+}
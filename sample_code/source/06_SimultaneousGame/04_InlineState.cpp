@@ -0,0 +1,1140 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <vector>
+#include <array>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <queue>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+constexpr const int H = 5;   // 미로의 높이
+constexpr const int W = 5;   // 미로의 너비
+constexpr int END_TURN = 20; // 게임 종료 턴
+
+using ScoreType = int64_t;
+constexpr const ScoreType INF = 1000000000LL;
+
+static const std::string dstr[4] = {"RIGHT", "LEFT", "DOWN", "UP"};
+
+enum WinningStatus
+{
+    FIRST,  // 플레이어 0이 승리
+    SECOND, // 플레이어 1이 승리
+    DRAW,
+    NONE,
+};
+
+// 동시 2인 게임 예
+// 1턴에 상하좌우 네 방향 중 하나로 벽이 없는 장소로 한 칸 이동한다.
+// 바닥에 있는 점수를 차지하면 자신의 점수가 되고, 바닥의 점수는 사라진다.
+// END_TURN 시점에 기록 점수가 상대방보다 많으면 승리한다.
+class SimultaneousMazeState
+{
+private:
+public:
+    // AlternateMazeState 생성자에서 참조하기 위해서 모든 멤버를 public으로 만듬
+    static constexpr const int dx[4] = {1, -1, 0, 0};
+    static constexpr const int dy[4] = {0, 0, 1, -1};
+    // [고정 크기 배치] : 게임판을 힙을 쓰지 않는 고정 크기 배열로 두어서 복사가 memcpy 한 번으로 끝나게 한다.
+    struct Character
+    {
+        uint8_t y_;
+        uint8_t x_;
+        uint16_t game_score_;
+        Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+    };
+    std::array<std::array<uint8_t, W>, H> points_; // 바닥의 점수는 1~9 중 하나
+    uint8_t turn_;                                 // 현재 턴
+    std::array<Character, 2> characters_;
+
+    SimultaneousMazeState(const int seed) : points_(),
+                                            turn_(0),
+                                            characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+    {
+        auto mt_for_construct = std::mt19937(seed);
+
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W / 2 + 1; x++)
+            {
+                int ty = y;
+                int tx = x;
+                int point = mt_for_construct() % 10;
+                if (characters_[0].y_ == y && characters_[0].x_ == x)
+                {
+                    continue;
+                }
+                if (characters_[1].y_ == y && characters_[1].x_ == x)
+                {
+                    continue;
+                }
+                this->points_[ty][tx] = point;
+                tx = W - 1 - x;
+                this->points_[ty][tx] = point;
+            }
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        if (isDone())
+        {
+            if (characters_[0].game_score_ > characters_[1].game_score_)
+                return WinningStatus::FIRST;
+            else if (characters_[0].game_score_ < characters_[1].game_score_)
+                return WinningStatus::SECOND;
+            else
+                return WinningStatus::DRAW;
+        }
+        else
+        {
+            return WinningStatus::NONE;
+        }
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return this->turn_ == END_TURN;
+    }
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행한다.
+    void advance(const int action0, const int action1)
+    {
+        {
+            auto &character = this->characters_[0];
+            const auto &action = action0;
+            character.x_ += dx[action];
+            character.y_ += dy[action];
+            const auto point = this->points_[character.y_][character.x_];
+            if (point > 0)
+            {
+                character.game_score_ += point;
+            }
+        }
+        {
+            auto &character = this->characters_[1];
+            const auto &action = action1;
+            character.x_ += dx[action];
+            character.y_ += dy[action];
+            const auto point = this->points_[character.y_][character.x_];
+            if (point > 0)
+            {
+                character.game_score_ += point;
+            }
+        }
+
+        for (const auto &character : this->characters_)
+        {
+            this->points_[character.y_][character.x_] = 0;
+        }
+        this->turn_++;
+    }
+
+    // [모든 게임에서 구현] : 지정한 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions(const int player_id) const
+    {
+        std::vector<int> actions;
+        const auto &character = this->characters_[player_id];
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = character.y_ + dy[action];
+            int tx = character.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+            {
+                actions.emplace_back(action);
+            }
+        }
+        return actions;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 플레이어 0의 승리 확률을 계산하기 위해서 기록 점수를 계산한다.
+    double getFirstPlayerScoreForWinRate() const
+    {
+        switch (this->getWinningStatus())
+        {
+        case (WinningStatus::FIRST):
+            return 1.;
+        case (WinningStatus::SECOND):
+            return 0.;
+        default:
+            return 0.5;
+        }
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss("");
+        ss << "turn:\t" << (int)this->turn_ << "\n";
+        for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+        {
+            ss << "score(" << player_id << "):\t" << this->characters_[player_id].game_score_ << "\n";
+        }
+        for (int h = 0; h < H; h++)
+        {
+            for (int w = 0; w < W; w++)
+            {
+                bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                {
+                    const auto &character = this->characters_[player_id];
+                    if (character.y_ == h && character.x_ == w)
+                    {
+                        if (player_id == 0)
+                        {
+                            ss << 'A';
+                        }
+                        else
+                        {
+                            ss << 'B';
+                        }
+                        is_written = true;
+                    }
+                }
+                if (!is_written)
+                {
+                    if (this->points_[h][w] > 0)
+                    {
+                        ss << (int)points_[h][w];
+                    }
+                    else
+                    {
+                        ss << '.';
+                    }
+                }
+            }
+            ss << '\n';
+        }
+
+        return ss.str();
+    }
+};
+// [고정 크기 배치] : 좌표, 점수, 턴이 uint8_t, uint16_t에 들어가는지 확인한다.
+static_assert(H <= UINT8_MAX && W <= UINT8_MAX && END_TURN * 2 <= UINT8_MAX, "board does not fit in uint8_t");
+static_assert(H * W * 9 <= UINT16_MAX, "game score does not fit in uint16_t");
+static_assert(std::is_trivially_copyable<SimultaneousMazeState>::value, "SimultaneousMazeState must be trivially copyable");
+static_assert(sizeof(SimultaneousMazeState) <= 64, "SimultaneousMazeState must fit in a cache line");
+using State = SimultaneousMazeState;
+
+// 지정한 플레이어 행동을 무작위로 결정한다.
+int randomAction(const State &state, const int player_id)
+{
+    auto legal_actions = state.legalActions(player_id);
+    return legal_actions[mt_for_action() % (legal_actions.size())];
+}
+
+class AlternateMazeState
+{
+private:
+    static constexpr const int END_TURN_ = END_TURN * 2; // 동시에 두는 게임의 1턴은 교대로 두는 게임의 2턴 분량
+    static constexpr const int dx[4] = {1, -1, 0, 0};
+    static constexpr const int dy[4] = {0, 0, 1, -1};
+    // [고정 크기 배치] : SimultaneousMazeState와 같은 고정 크기 배열을 쓴다.
+    std::array<std::array<uint8_t, W>, H> points_; // 바닥의 점수는 1~9 중 하나
+    uint8_t turn_;                                 // 현재 턴
+    using Character = SimultaneousMazeState::Character;
+    std::array<Character, 2> characters_;
+
+public:
+    AlternateMazeState(const SimultaneousMazeState &base_state, const int player_id) : points_(base_state.points_),
+                                                                                       turn_(base_state.turn_ * 2), // 동시에 두는 게임의 1턴은 교대로 두는 게임의 2턴 분량
+                                                                                       characters_(base_state.characters_)
+    {
+        if (player_id == 1)
+        {
+            std::swap(this->characters_[0], this->characters_[1]);
+        }
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        if (isDone())
+        {
+            if (characters_[0].game_score_ > characters_[1].game_score_)
+                return WinningStatus::FIRST; // WIN
+            else if (characters_[0].game_score_ < characters_[1].game_score_)
+                return WinningStatus::SECOND; // LOSE
+            else
+                return WinningStatus::DRAW;
+        }
+        else
+        {
+            return WinningStatus::NONE;
+        }
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return this->turn_ == END_TURN_;
+    }
+
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+    void advance(const int action)
+    {
+        auto &character = this->characters_[0];
+        character.x_ += dx[action];
+        character.y_ += dy[action];
+        auto &point = this->points_[character.y_][character.x_];
+        if (point > 0)
+        {
+            character.game_score_ += point;
+            point = 0;
+        }
+        this->turn_++;
+        std::swap(this->characters_[0], this->characters_[1]);
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        constexpr const int player_id = 0;
+        const auto &character = this->characters_[player_id];
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = character.y_ + dy[action];
+            int tx = character.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+            {
+                actions.emplace_back(action);
+            }
+        }
+        return actions;
+    }
+};
+static_assert(std::is_trivially_copyable<AlternateMazeState>::value, "AlternateMazeState must be trivially copyable");
+static_assert(sizeof(AlternateMazeState) <= 64, "AlternateMazeState must fit in a cache line");
+using AlternateState = AlternateMazeState;
+
+namespace vector_layout
+{
+    // 비교용 : 게임판을 std::vector로 보관하는 기존 배치
+    class VectorSimultaneousMazeState
+    {
+    private:
+    public:
+        // VectorAlternateMazeState 생성자에서 참조하기 위해서 모든 멤버를 public으로 만듬
+        static constexpr const int dx[4] = {1, -1, 0, 0};
+        static constexpr const int dy[4] = {0, 0, 1, -1};
+        struct Character
+        {
+            int y_;
+            int x_;
+            int game_score_;
+            Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+        };
+        std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+        int turn_;                             // 현재 턴
+        std::vector<Character> characters_;
+
+        VectorSimultaneousMazeState(const int seed) : points_(H, std::vector<int>(W)),
+                                                turn_(0),
+                                                characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+        {
+            auto mt_for_construct = std::mt19937(seed);
+
+            for (int y = 0; y < H; y++)
+                for (int x = 0; x < W / 2 + 1; x++)
+                {
+                    int ty = y;
+                    int tx = x;
+                    int point = mt_for_construct() % 10;
+                    if (characters_[0].y_ == y && characters_[0].x_ == x)
+                    {
+                        continue;
+                    }
+                    if (characters_[1].y_ == y && characters_[1].x_ == x)
+                    {
+                        continue;
+                    }
+                    this->points_[ty][tx] = point;
+                    tx = W - 1 - x;
+                    this->points_[ty][tx] = point;
+                }
+        }
+
+        // [모든 게임에서 구현] : 승패 정보를 획득한다.
+        WinningStatus getWinningStatus() const
+        {
+            if (isDone())
+            {
+                if (characters_[0].game_score_ > characters_[1].game_score_)
+                    return WinningStatus::FIRST;
+                else if (characters_[0].game_score_ < characters_[1].game_score_)
+                    return WinningStatus::SECOND;
+                else
+                    return WinningStatus::DRAW;
+            }
+            else
+            {
+                return WinningStatus::NONE;
+            }
+        }
+
+        // [모든 게임에서 구현] : 게임 종료 판정
+        bool isDone() const
+        {
+            return this->turn_ == END_TURN;
+        }
+        // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행한다.
+        void advance(const int action0, const int action1)
+        {
+            {
+                auto &character = this->characters_[0];
+                const auto &action = action0;
+                character.x_ += dx[action];
+                character.y_ += dy[action];
+                const auto point = this->points_[character.y_][character.x_];
+                if (point > 0)
+                {
+                    character.game_score_ += point;
+                }
+            }
+            {
+                auto &character = this->characters_[1];
+                const auto &action = action1;
+                character.x_ += dx[action];
+                character.y_ += dy[action];
+                const auto point = this->points_[character.y_][character.x_];
+                if (point > 0)
+                {
+                    character.game_score_ += point;
+                }
+            }
+
+            for (const auto &character : this->characters_)
+            {
+                this->points_[character.y_][character.x_] = 0;
+            }
+            this->turn_++;
+        }
+
+        // [모든 게임에서 구현] : 지정한 플레이어가 가능한 행동을 모두 획득한다.
+        std::vector<int> legalActions(const int player_id) const
+        {
+            std::vector<int> actions;
+            const auto &character = this->characters_[player_id];
+            for (int action = 0; action < 4; action++)
+            {
+                int ty = character.y_ + dy[action];
+                int tx = character.x_ + dx[action];
+                if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+                {
+                    actions.emplace_back(action);
+                }
+            }
+            return actions;
+        }
+
+        // [필수는 아니지만 구현하면 편리] : 플레이어 0의 승리 확률을 계산하기 위해서 기록 점수를 계산한다.
+        double getFirstPlayerScoreForWinRate() const
+        {
+            switch (this->getWinningStatus())
+            {
+            case (WinningStatus::FIRST):
+                return 1.;
+            case (WinningStatus::SECOND):
+                return 0.;
+            default:
+                return 0.5;
+            }
+        }
+
+        // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+        std::string toString() const
+        {
+            std::stringstream ss("");
+            ss << "turn:\t" << this->turn_ << "\n";
+            for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+            {
+                ss << "score(" << player_id << "):\t" << this->characters_[player_id].game_score_ << "\n";
+            }
+            for (int h = 0; h < H; h++)
+            {
+                for (int w = 0; w < W; w++)
+                {
+                    bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                    for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                    {
+                        const auto &character = this->characters_[player_id];
+                        if (character.y_ == h && character.x_ == w)
+                        {
+                            if (player_id == 0)
+                            {
+                                ss << 'A';
+                            }
+                            else
+                            {
+                                ss << 'B';
+                            }
+                            is_written = true;
+                        }
+                    }
+                    if (!is_written)
+                    {
+                        if (this->points_[h][w] > 0)
+                        {
+                            ss << points_[h][w];
+                        }
+                        else
+                        {
+                            ss << '.';
+                        }
+                    }
+                }
+                ss << '\n';
+            }
+
+            return ss.str();
+        }
+    };
+
+    class VectorAlternateMazeState
+    {
+    private:
+        static constexpr const int END_TURN_ = END_TURN * 2; // 동시에 두는 게임의 1턴은 교대로 두는 게임의 2턴 분량
+        static constexpr const int dx[4] = {1, -1, 0, 0};
+        static constexpr const int dy[4] = {0, 0, 1, -1};
+        std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+        int turn_;                             // 현재 턴
+        using Character = VectorSimultaneousMazeState::Character;
+        std::vector<Character> characters_;
+
+    public:
+        VectorAlternateMazeState(const VectorSimultaneousMazeState &base_state, const int player_id) : points_(base_state.points_),
+                                                                                           turn_(base_state.turn_ * 2), // 동시에 두는 게임의 1턴은 교대로 두는 게임의 2턴 분량
+                                                                                           characters_(player_id == 0 ? base_state.characters_ : std::vector<Character>{base_state.characters_[1], base_state.characters_[0]})
+        {
+        }
+
+        // [모든 게임에서 구현] : 승패 정보를 획득한다.
+        WinningStatus getWinningStatus() const
+        {
+            if (isDone())
+            {
+                if (characters_[0].game_score_ > characters_[1].game_score_)
+                    return WinningStatus::FIRST; // WIN
+                else if (characters_[0].game_score_ < characters_[1].game_score_)
+                    return WinningStatus::SECOND; // LOSE
+                else
+                    return WinningStatus::DRAW;
+            }
+            else
+            {
+                return WinningStatus::NONE;
+            }
+        }
+
+        // [모든 게임에서 구현] : 게임 종료 판정
+        bool isDone() const
+        {
+            return this->turn_ == END_TURN_;
+        }
+
+        // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+        void advance(const int action)
+        {
+            auto &character = this->characters_[0];
+            character.x_ += dx[action];
+            character.y_ += dy[action];
+            auto &point = this->points_[character.y_][character.x_];
+            if (point > 0)
+            {
+                character.game_score_ += point;
+                point = 0;
+            }
+            this->turn_++;
+            std::swap(this->characters_[0], this->characters_[1]);
+        }
+
+        // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+        std::vector<int> legalActions() const
+        {
+            std::vector<int> actions;
+            constexpr const int player_id = 0;
+            const auto &character = this->characters_[player_id];
+            for (int action = 0; action < 4; action++)
+            {
+                int ty = character.y_ + dy[action];
+                int tx = character.x_ + dx[action];
+                if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+                {
+                    actions.emplace_back(action);
+                }
+            }
+            return actions;
+        }
+    };
+}
+
+namespace altanate_motecalo
+{
+    // 무작위로 행동을 결정한다.
+    int randomAction(const AlternateState &state)
+    {
+        auto legal_actions = state.legalActions();
+        return legal_actions[mt_for_action() % (legal_actions.size())];
+    }
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(AlternateState *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::FIRST): // WIN
+            return 1.;
+        case (WinningStatus::SECOND): // LOSE
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state));
+            return 1. - playout(state);
+        }
+    }
+    constexpr const double C = 1.;             // UCB1 계산에 사용하는 상수
+    constexpr const int EXPAND_THRESHOLD = 10; // 노드를 확장하는 임계치
+
+    // MCTS 계산에 사용하는 노드
+    class Node
+    {
+    private:
+        AlternateState state_;
+        double w_;
+
+    public:
+        std::vector<Node> child_nodes;
+        double n_;
+
+        // 노드를 평가한다.
+        double evaluate()
+        {
+            if (this->state_.isDone())
+            {
+                double value = 0.5;
+                switch (this->state_.getWinningStatus())
+                {
+                case (WinningStatus::FIRST):
+                    value = 1.;
+                    break;
+                case (WinningStatus::SECOND):
+                    value = 0.;
+                    break;
+                default:
+                    break;
+                }
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+            if (this->child_nodes.empty())
+            {
+                AlternateState state_copy = this->state_;
+                double value = playout(&state_copy);
+                this->w_ += value;
+                ++this->n_;
+
+                if (this->n_ == EXPAND_THRESHOLD)
+                    this->expand();
+
+                return value;
+            }
+            else
+            {
+                double value = 1. - this->nextChildNode().evaluate();
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+        }
+
+        // 노드를 확장한다.
+        void expand()
+        {
+            auto legal_actions = this->state_.legalActions();
+            this->child_nodes.clear();
+            for (const auto action : legal_actions)
+            {
+                this->child_nodes.emplace_back(this->state_);
+                this->child_nodes.back().state_.advance(action);
+            }
+        }
+
+        // 어떤 노드를 평가할지 선택한다.
+        Node &nextChildNode()
+        {
+            for (auto &child_node : this->child_nodes)
+            {
+                if (child_node.n_ == 0)
+                    return child_node;
+            }
+            double t = 0;
+            for (const auto &child_node : this->child_nodes)
+            {
+                t += child_node.n_;
+            }
+            double best_value = -INF;
+            int best_action_index = -1;
+            for (int i = 0; i < this->child_nodes.size(); i++)
+            {
+                const auto &child_node = this->child_nodes[i];
+                double ucb1_value = 1. - child_node.w_ / child_node.n_ + (double)C * std::sqrt(2. * std::log(t) / child_node.n_);
+                if (ucb1_value > best_value)
+                {
+                    best_action_index = i;
+                    best_value = ucb1_value;
+                }
+            }
+            return this->child_nodes[best_action_index];
+        }
+
+        Node(const AlternateState &state) : state_(state), w_(0), n_(0) {}
+    };
+
+    // 플레이아웃 횟수를 지정해서 MCTS로 행동을 결정한다.
+    int mctsAction(const State &base_state, const int player_id, const int playout_number)
+    {
+        auto state = AlternateState(base_state, player_id);
+        Node root_node = Node(state);
+        root_node.expand();
+        for (int i = 0; i < playout_number; i++)
+        {
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+
+}
+using altanate_motecalo::mctsAction;
+
+namespace montecarlo
+{
+    // 플레이어 0 시점에서 평가
+    double playout(State *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::FIRST):
+            return 1.;
+        case (WinningStatus::SECOND):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state, 0), randomAction(*state, 1));
+            return playout(state);
+        }
+    }
+    // 플레이아웃 횟수를 지정해서 순수 몬테카를로 탐색으로 지정한 플레이어의 행동을 결정한다.
+    int primitiveMontecarloAction(const State &state, const int player_id, const int playout_number)
+    {
+        auto my_legal_actions = state.legalActions(player_id);
+        auto opp_legal_actions = state.legalActions((player_id + 1) % 2);
+        double best_value = -INF;
+        int best_action_index = -1;
+        for (int i = 0; i < my_legal_actions.size(); i++)
+        {
+            double value = 0;
+            for (int j = 0; j < playout_number; j++)
+            {
+                State next_state = state;
+                if (player_id == 0)
+                {
+                    next_state.advance(my_legal_actions[i], opp_legal_actions[mt_for_action() % opp_legal_actions.size()]);
+                }
+                else
+                {
+                    next_state.advance(opp_legal_actions[mt_for_action() % opp_legal_actions.size()], my_legal_actions[i]);
+                }
+                double player0_win_rate = playout(&next_state);
+                double win_rate = (player_id == 0 ? player0_win_rate : 1. - player0_win_rate);
+                value += win_rate;
+            }
+            if (value > best_value)
+            {
+                best_action_index = i;
+                best_value = value;
+            }
+        }
+        return my_legal_actions[best_action_index];
+    }
+
+    constexpr const double C = 1.;            // UCB1 계산에 사용하는 상수
+    constexpr const int EXPAND_THRESHOLD = 5; // 노드를 확장하는 임계치
+
+    // DUCT 계산에 사용하는 노드
+    class Node
+    {
+    private:
+        State state_;
+        double w_;
+
+    public:
+        std::vector<std::vector<Node>> child_nodeses_;
+        double n_;
+
+        // 플레이어 0 시점에서 노드를 평가한다.
+        double evaluate()
+        {
+            if (this->state_.isDone())
+            {
+                double value = 0.5;
+                switch (this->state_.getWinningStatus())
+                {
+                case (WinningStatus::FIRST):
+                    value = 1.;
+                    break;
+                case (WinningStatus::SECOND):
+                    value = 0.;
+                    break;
+                default:
+                    break;
+                }
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+            if (this->child_nodeses_.empty())
+            {
+                State state_copy = this->state_;
+                double value = playout(&state_copy);
+                this->w_ += value;
+                ++this->n_;
+
+                if (this->n_ == EXPAND_THRESHOLD)
+                    this->expand();
+
+                return value;
+            }
+            else
+            {
+                double value = this->nextChildNode().evaluate();
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+        }
+        // 노드를 확장한다.
+        void expand()
+        {
+            auto legal_actions0 = this->state_.legalActions(0);
+            auto legal_actions1 = this->state_.legalActions(1);
+            this->child_nodeses_.clear();
+            for (const auto &action0 : legal_actions0)
+            {
+                this->child_nodeses_.emplace_back();
+                auto &target_nodes = this->child_nodeses_.back();
+                for (const auto &action1 : legal_actions1)
+                {
+                    target_nodes.emplace_back(this->state_);
+                    auto &target_node = target_nodes.back();
+                    target_node.state_.advance(action0, action1);
+                }
+            }
+        }
+        // 어떤 노드를 평가할지 선택한다.
+        Node &nextChildNode()
+        {
+            for (auto &child_nodes : this->child_nodeses_)
+            {
+                for (auto &child_node : child_nodes)
+                {
+                    if (child_node.n_ == 0)
+                        return child_node;
+                }
+            }
+            double t = 0;
+            for (auto &child_nodes : this->child_nodeses_)
+            {
+                for (auto &child_node : child_nodes)
+                {
+                    t += child_node.n_;
+                }
+            }
+            int best_is[] = {-1, -1};
+
+            // 플레이어 0의 행동 선택(어느 쪽 플레이어인지 관계없이 여기서는 플레이어 0의 행동)
+            double best_value = -INF;
+            for (int i = 0; i < this->child_nodeses_.size(); i++)
+            {
+                const auto &childe_nodes = this->child_nodeses_[i];
+                double w = 0;
+                double n = 0;
+                for (int j = 0; j < childe_nodes.size(); j++)
+                {
+                    const auto &child_node = childe_nodes[j];
+                    w += child_node.w_;
+                    n += child_node.n_;
+                }
+
+                double ucb1_value = w / n + (double)C * std::sqrt(2. * std::log(t) / n);
+                if (ucb1_value > best_value)
+                {
+                    best_is[0] = i;
+                    best_value = ucb1_value;
+                }
+            }
+            // 플레이어 1의 행동 선택(어느 쪽 플레이어인지 관계없이 여기서는 플레이어 1의 행동)
+            best_value = -INF;
+            for (int j = 0; j < this->child_nodeses_[0].size(); j++)
+            {
+                double w = 0;
+                double n = 0;
+                for (int i = 0; i < this->child_nodeses_.size(); i++)
+                {
+                    const auto &child_node = child_nodeses_[i][j];
+                    w += child_node.w_;
+                    n += child_node.n_;
+                }
+                w = 1. - w; // 상대방 쪽의 행동 선택 차례이므로 평가를 반전시켜야 함
+                double ucb1_value = w / n + (double)C * std::sqrt(2. * std::log(t) / n);
+                if (ucb1_value > best_value)
+                {
+                    best_is[1] = j;
+                    best_value = ucb1_value;
+                }
+            }
+
+            return this->child_nodeses_[best_is[0]][best_is[1]];
+        }
+
+        Node(const State &state) : state_(state), w_(0), n_(0) {}
+    };
+
+    // 플레이아웃 횟수를 지정해서 DUCT로 지정한 플레이어의 행동을 결정한다.
+    int ductAction(const State &state, const int player_id, const int playout_number)
+    {
+        Node root_node = Node(state);
+        root_node.expand();
+        for (int i = 0; i < playout_number; i++)
+        {
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions(player_id);
+        int i_size = root_node.child_nodeses_.size();
+        int j_size = root_node.child_nodeses_[0].size();
+
+        if (player_id == 0)
+        {
+            int best_action_searched_number = -1;
+            int best_action_index = -1;
+            for (int i = 0; i < i_size; i++)
+            {
+                int n = 0;
+                for (int j = 0; j < j_size; j++)
+                {
+                    n += root_node.child_nodeses_[i][j].n_;
+                }
+                if (n > best_action_searched_number)
+                {
+                    best_action_index = i;
+                    best_action_searched_number = n;
+                }
+            }
+            return legal_actions[best_action_index];
+        }
+        else
+        {
+            int best_action_searched_number = -1;
+            int best_j = -1;
+            for (int j = 0; j < j_size; j++)
+            {
+                int n = 0;
+                for (int i = 0; i < i_size; i++)
+                {
+                    n += root_node.child_nodeses_[i][j].n_;
+                }
+                if (n > best_action_searched_number)
+                {
+                    best_j = j;
+                    best_action_searched_number = n;
+                }
+            }
+            return legal_actions[best_j];
+        }
+    }
+};
+using ::montecarlo::ductAction;
+using ::montecarlo::primitiveMontecarloAction;
+
+#include <iostream>
+#include <functional>
+
+using AIFunction = std::function<int(const State &, const int)>;
+using StringAIPair = std::pair<std::string, AIFunction>;
+
+// 게임을 game_number번 플레이해서 ais의 0번째 AI 승률을 표시한다.
+void testFirstPlayerWinRate(std::array<StringAIPair, 2> &ais, const int game_number)
+{
+    using std::cout;
+    using std::endl;
+    std::mt19937 mt_for_construct(0);
+
+    double first_player_win_rate = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(mt_for_construct());
+        auto &first_ai = ais[0];
+        auto &second_ai = ais[1];
+        while (true)
+        {
+            state.advance(first_ai.second(state, 0), second_ai.second(state, 1));
+            if (state.isDone())
+                break;
+        }
+        double win_rate_point = state.getFirstPlayerScoreForWinRate();
+        if (win_rate_point >= 0)
+        {
+            state.toString();
+        }
+        first_player_win_rate += win_rate_point;
+
+        cout << "i " << i << " w " << first_player_win_rate / (i + 1) << endl;
+    }
+    first_player_win_rate /= (double)game_number;
+    cout << "Winning rate of " << ais[0].first << " to " << ais[1].first << ":\t" << first_player_win_rate << endl;
+}
+
+// 같은 행동열을 두 배치의 게임판에 적용해서 합법 수, 승패, 표시 결과가 모두 같은지 확인한다.
+void testSameTransition(const int game_number)
+{
+    using std::cout;
+    using std::endl;
+    int mismatch_number = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(i);
+        auto vector_state = vector_layout::VectorSimultaneousMazeState(i);
+        while (true)
+        {
+            bool is_same = state.getWinningStatus() == vector_state.getWinningStatus() &&
+                           state.toString() == vector_state.toString();
+            for (int player_id = 0; player_id < 2; player_id++)
+            {
+                is_same = is_same && state.legalActions(player_id) == vector_state.legalActions(player_id);
+
+                // 교대로 두는 게임으로 바꾼 게임판도 끝까지 같은 결과가 되는지 확인한다.
+                auto alternate_state = AlternateState(state, player_id);
+                auto vector_alternate_state = vector_layout::VectorAlternateMazeState(vector_state, player_id);
+                while (is_same)
+                {
+                    const auto legal_actions = alternate_state.legalActions();
+                    is_same = legal_actions == vector_alternate_state.legalActions() &&
+                              alternate_state.getWinningStatus() == vector_alternate_state.getWinningStatus();
+                    if (alternate_state.isDone())
+                    {
+                        break;
+                    }
+                    const int action = legal_actions[mt_for_action() % legal_actions.size()];
+                    alternate_state.advance(action);
+                    vector_alternate_state.advance(action);
+                }
+            }
+            if (!is_same)
+            {
+                ++mismatch_number;
+                break;
+            }
+            if (state.isDone())
+            {
+                break;
+            }
+            const int action0 = randomAction(state, 0);
+            const int action1 = randomAction(state, 1);
+            state.advance(action0, action1);
+            vector_state.advance(action0, action1);
+        }
+    }
+    cout << "mismatch " << mismatch_number << " / " << game_number << endl;
+}
+
+// 게임판을 지정한 횟수만큼 복사하는 데 걸린 시간을 표시한다.
+template <typename CopyState>
+void testCopySpeed(const std::string &name, const int copy_number)
+{
+    using std::cout;
+    using std::endl;
+    const auto state = CopyState(0);
+    int64_t sum = 0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < copy_number; i++)
+    {
+        auto copied = state;
+        copied.advance(copied.legalActions(0)[0], copied.legalActions(1)[0]);
+        sum += copied.characters_[0].game_score_;
+    }
+    auto diff = std::chrono::high_resolution_clock::now() - start_time;
+    cout << name << "\tsizeof " << sizeof(CopyState) << "\t" << std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() << " ms to copy " << copy_number << " states (" << sum << ")" << endl;
+}
+
+// 무작위로 진행한 게임판에서 ai를 실행하는 데 걸린 시간을 표시한다.
+void calculateExecutionSpeed(const StringAIPair &ai, const int game_number)
+{
+    using std::cout;
+    using std::endl;
+    std::mt19937 mt_for_construct(0);
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(mt_for_construct());
+        while (!state.isDone())
+        {
+            state.advance(ai.second(state, 0), randomAction(state, 1));
+        }
+    }
+    auto diff = std::chrono::high_resolution_clock::now() - start_time;
+    cout << ai.first << " take " << std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() << " ms to play " << game_number << " games" << endl;
+}
+
+int main()
+{
+    testSameTransition(1000);
+    testCopySpeed<vector_layout::VectorSimultaneousMazeState>("VectorSimultaneousMazeState", 1000000);
+    testCopySpeed<State>("SimultaneousMazeState", 1000000);
+
+    calculateExecutionSpeed(
+        StringAIPair("ductAction", [](const State &state, const int player_id)
+                     { return ductAction(state, player_id, 1000); }),
+        10);
+    calculateExecutionSpeed(
+        StringAIPair("mctsAction", [](const State &state, const int player_id)
+                     { return mctsAction(state, player_id, 1000); }),
+        10);
+    calculateExecutionSpeed(
+        StringAIPair("primitiveMontecarloAction", [](const State &state, const int player_id)
+                     { return primitiveMontecarloAction(state, player_id, 1000); }),
+        10);
+
+    auto ais = std::array<StringAIPair, 2>{
+        StringAIPair("ductAction", [](const State &state, const int player_id)
+                     { return ductAction(state, player_id, 1000); }),
+        StringAIPair("mctsAction", [](const State &state, const int player_id)
+                     { return mctsAction(state, player_id, 1000); }),
+    };
+
+    testFirstPlayerWinRate(ais, 100);
+
+    return 0;
+}
@@ -0,0 +1,852 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <array>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+#include <queue>
+#pragma GCC diagnostic ignored "-Wsign-compare"
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+// 세 게임은 미로 크기와 승패 정보가 서로 다르므로 이름공간으로 나누어 둔다.
+
+// 교대로 두는 2인 게임(5장)
+namespace alternate
+{
+    constexpr const int H = 10;  // 미로의 높이
+    constexpr const int W = 10;  // 미로의 너비
+    constexpr int END_TURN = 50; // 게임 종료 턴
+
+    using ScoreType = int64_t;
+    constexpr const ScoreType INF = 1000000000LL;
+
+    enum WinningStatus
+    {
+        WIN,
+        LOSE,
+        DRAW,
+        NONE,
+    };
+
+    class AlternateMazeState
+    {
+    public:
+        static constexpr const int MAX_ACTION_NUMBER = 4; // 한 턴에 가능한 행동 수의 최댓값
+
+    private:
+        static constexpr const int dx[4] = {1, -1, 0, 0};
+        static constexpr const int dy[4] = {0, 0, 1, -1};
+        struct Character
+        {
+            int y_;
+            int x_;
+            int game_score_;
+            Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+        };
+        std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+        int turn_;                             // 현재 턴
+        std::vector<Character> characters_;
+
+        // 현재 플레이어가 선공인지 판정한다.
+        bool isFirstPlayer() const
+        {
+            return this->turn_ % 2 == 0;
+        }
+
+    public:
+        AlternateMazeState(const int seed) : points_(H, std::vector<int>(W)),
+                                             turn_(0),
+                                             characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+        {
+            auto mt_for_construct = std::mt19937(seed);
+
+            for (int y = 0; y < H; y++)
+                for (int x = 0; x < W; x++)
+                {
+                    int point = mt_for_construct() % 10;
+                    if (characters_[0].y_ == y && characters_[0].x_ == x)
+                    {
+                        continue;
+                    }
+                    if (characters_[1].y_ == y && characters_[1].x_ == x)
+                    {
+                        continue;
+                    }
+
+                    this->points_[y][x] = point;
+                }
+        }
+
+        // [모든 게임에서 구현] : 게임 종료 판정
+        bool isDone() const
+        {
+            return this->turn_ == END_TURN;
+        }
+
+        // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+        void advance(const int action)
+        {
+            auto &character = this->characters_[0];
+            character.x_ += dx[action];
+            character.y_ += dy[action];
+            auto &point = this->points_[character.y_][character.x_];
+            if (point > 0)
+            {
+                character.game_score_ += point;
+                point = 0;
+            }
+            this->turn_++;
+            std::swap(this->characters_[0], this->characters_[1]);
+        }
+
+        // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+        std::vector<int> legalActions() const
+        {
+            std::vector<int> actions;
+            const auto &character = this->characters_[0];
+            for (int action = 0; action < 4; action++)
+            {
+                int ty = character.y_ + dy[action];
+                int tx = character.x_ + dx[action];
+                if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+                {
+                    actions.emplace_back(action);
+                }
+            }
+            return actions;
+        }
+
+        // [플레이아웃 고속화] : 현재 플레이어가 가능한 행동을 actions에 기록하고 개수를 돌려준다.
+        int legalActions(int *actions) const
+        {
+            int action_number = 0;
+            const auto &character = this->characters_[0];
+            for (int action = 0; action < 4; action++)
+            {
+                int ty = character.y_ + dy[action];
+                int tx = character.x_ + dx[action];
+                if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+                {
+                    actions[action_number++] = action;
+                }
+            }
+            return action_number;
+        }
+
+        // [모든 게임에서 구현] : 승패 정보를 획득한다.
+        WinningStatus getWinningStatus() const
+        {
+            if (isDone())
+            {
+                if (characters_[0].game_score_ > characters_[1].game_score_)
+                    return WinningStatus::WIN;
+                else if (characters_[0].game_score_ < characters_[1].game_score_)
+                    return WinningStatus::LOSE;
+                else
+                    return WinningStatus::DRAW;
+            }
+            else
+            {
+                return WinningStatus::NONE;
+            }
+        }
+
+        // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가한다.
+        ScoreType getScore() const
+        {
+            return characters_[0].game_score_ - characters_[1].game_score_;
+        }
+        // [모든 게임에서 구현] : 현재 플레이어 시점에서 게임판을 평가해서 0~1 값을 돌려준다.
+        double getScoreRate() const
+        {
+            if (characters_[0].game_score_ + characters_[1].game_score_ == 0)
+                return 0.;
+            return ((double)characters_[0].game_score_) / (double)(characters_[0].game_score_ + characters_[1].game_score_);
+        }
+
+        // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+        double getFirstPlayerScoreForWinRate() const
+        {
+            switch (this->getWinningStatus())
+            {
+            case (WinningStatus::WIN):
+                if (this->isFirstPlayer())
+                {
+                    return 1.;
+                }
+                else
+                {
+                    return 0.;
+                }
+            case (WinningStatus::LOSE):
+                if (this->isFirstPlayer())
+                {
+                    return 0.;
+                }
+                else
+                {
+                    return 1.;
+                }
+            default:
+                return 0.5;
+            }
+        }
+
+        // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+        std::string toString() const
+        {
+            std::stringstream ss("");
+            ss << "turn:\t" << this->turn_ << "\n";
+            for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+            {
+                int actual_player_id = player_id;
+                if (this->turn_ % 2 == 1)
+                {
+                    actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                }
+                const auto &chara = this->characters_[actual_player_id];
+                ss << "score(" << player_id << "):\t" << chara.game_score_ << "\ty: " << chara.y_ << " x: " << chara.x_ << "\n";
+            }
+            for (int h = 0; h < H; h++)
+            {
+                for (int w = 0; w < W; w++)
+                {
+                    bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                    for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                    {
+                        int actual_player_id = player_id;
+                        if (this->turn_ % 2 == 1)
+                        {
+                            actual_player_id = (player_id + 1) % 2; // 짝수 턴은 초기 배치 시점에서 보면 player_id가 반대
+                        }
+
+                        const auto &character = this->characters_[player_id];
+                        if (character.y_ == h && character.x_ == w)
+                        {
+                            if (actual_player_id == 0)
+                            {
+                                ss << 'A';
+                            }
+                            else
+                            {
+                                ss << 'B';
+                            }
+                            is_written = true;
+                        }
+                    }
+                    if (!is_written)
+                    {
+                        if (this->points_[h][w] > 0)
+                        {
+                            ss << points_[h][w];
+                        }
+                        else
+                        {
+                            ss << '.';
+                        }
+                    }
+                }
+                ss << '\n';
+            }
+
+            return ss.str();
+        }
+    };
+
+    // 무작위로 행동을 결정한다.
+    int randomAction(const AlternateMazeState &state)
+    {
+        auto legal_actions = state.legalActions();
+        return legal_actions[mt_for_action() % (legal_actions.size())];
+    }
+
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(AlternateMazeState *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state));
+            return 1. - playout(state);
+        }
+    }
+}
+
+// 동시에 두는 2인 게임(6장)
+namespace simultaneous
+{
+    constexpr const int H = 5;   // 미로의 높이
+    constexpr const int W = 5;   // 미로의 너비
+    constexpr int END_TURN = 20; // 게임 종료 턴
+
+    using ScoreType = int64_t;
+    constexpr const ScoreType INF = 1000000000LL;
+
+
+    enum WinningStatus
+    {
+        FIRST,  // 플레이어 0이 승리
+        SECOND, // 플레이어 1이 승리
+        DRAW,
+        NONE,
+    };
+
+    // 동시 2인 게임 예
+    // 1턴에 상하좌우 네 방향 중 하나로 벽이 없는 장소로 한 칸 이동한다.
+    // 바닥에 있는 점수를 차지하면 자신의 점수가 되고, 바닥의 점수는 사라진다.
+    // END_TURN 시점에 기록 점수가 상대방보다 많으면 승리한다.
+    class SimultaneousMazeState
+    {
+    public:
+        static constexpr const int MAX_ACTION_NUMBER = 4; // 한 턴에 가능한 행동 수의 최댓값
+
+    private:
+        static constexpr const int dx[4] = {1, -1, 0, 0};
+        static constexpr const int dy[4] = {0, 0, 1, -1};
+        struct Character
+        {
+            int y_;
+            int x_;
+            int game_score_;
+            Character(const int y = 0, const int x = 0) : y_(y), x_(x), game_score_(0) {}
+        };
+        std::vector<std::vector<int>> points_; // 바닥의 점수는 1~9 중 하나
+        int turn_;                             // 현재 턴
+        std::vector<Character> characters_;
+
+    public:
+        SimultaneousMazeState(const int seed) : points_(H, std::vector<int>(W)),
+                                                turn_(0),
+                                                characters_({Character(H / 2, (W / 2) - 1), Character(H / 2, (W / 2) + 1)})
+        {
+            auto mt_for_construct = std::mt19937(seed);
+
+            for (int y = 0; y < H; y++)
+                for (int x = 0; x < W / 2 + 1; x++)
+                {
+                    int ty = y;
+                    int tx = x;
+                    int point = mt_for_construct() % 10;
+                    if (characters_[0].y_ == y && characters_[0].x_ == x)
+                    {
+                        continue;
+                    }
+                    if (characters_[1].y_ == y && characters_[1].x_ == x)
+                    {
+                        continue;
+                    }
+                    this->points_[ty][tx] = point;
+                    tx = W - 1 - x;
+                    this->points_[ty][tx] = point;
+                }
+        }
+
+        // [모든 게임에서 구현] : 승패 정보를 획득한다.
+        WinningStatus getWinningStatus() const
+        {
+            if (isDone())
+            {
+                if (characters_[0].game_score_ > characters_[1].game_score_)
+                    return WinningStatus::FIRST;
+                else if (characters_[0].game_score_ < characters_[1].game_score_)
+                    return WinningStatus::SECOND;
+                else
+                    return WinningStatus::DRAW;
+            }
+            else
+            {
+                return WinningStatus::NONE;
+            }
+        }
+
+        // [모든 게임에서 구현] : 게임 종료 판정
+        bool isDone() const
+        {
+            return this->turn_ == END_TURN;
+        }
+        // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행한다.
+        void advance(const int action0, const int action1)
+        {
+            {
+                auto &character = this->characters_[0];
+                const auto &action = action0;
+                character.x_ += dx[action];
+                character.y_ += dy[action];
+                const auto point = this->points_[character.y_][character.x_];
+                if (point > 0)
+                {
+                    character.game_score_ += point;
+                }
+            }
+            {
+                auto &character = this->characters_[1];
+                const auto &action = action1;
+                character.x_ += dx[action];
+                character.y_ += dy[action];
+                const auto point = this->points_[character.y_][character.x_];
+                if (point > 0)
+                {
+                    character.game_score_ += point;
+                }
+            }
+
+            for (const auto &character : this->characters_)
+            {
+                this->points_[character.y_][character.x_] = 0;
+            }
+            this->turn_++;
+        }
+
+        // [모든 게임에서 구현] : 지정한 플레이어가 가능한 행동을 모두 획득한다.
+        std::vector<int> legalActions(const int player_id) const
+        {
+            std::vector<int> actions;
+            const auto &character = this->characters_[player_id];
+            for (int action = 0; action < 4; action++)
+            {
+                int ty = character.y_ + dy[action];
+                int tx = character.x_ + dx[action];
+                if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+                {
+                    actions.emplace_back(action);
+                }
+            }
+            return actions;
+        }
+
+        // [플레이아웃 고속화] : 지정한 플레이어가 가능한 행동을 actions에 기록하고 개수를 돌려준다.
+        int legalActions(const int player_id, int *actions) const
+        {
+            int action_number = 0;
+            const auto &character = this->characters_[player_id];
+            for (int action = 0; action < 4; action++)
+            {
+                int ty = character.y_ + dy[action];
+                int tx = character.x_ + dx[action];
+                if (ty >= 0 && ty < H && tx >= 0 && tx < W)
+                {
+                    actions[action_number++] = action;
+                }
+            }
+            return action_number;
+        }
+
+        // [필수는 아니지만 구현하면 편리] : 플레이어 0의 승리 확률을 계산하기 위해서 기록 점수를 계산한다.
+        double getFirstPlayerScoreForWinRate() const
+        {
+            switch (this->getWinningStatus())
+            {
+            case (WinningStatus::FIRST):
+                return 1.;
+            case (WinningStatus::SECOND):
+                return 0.;
+            default:
+                return 0.5;
+            }
+        }
+
+        // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+        std::string toString() const
+        {
+            std::stringstream ss("");
+            ss << "turn:\t" << this->turn_ << "\n";
+            for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+            {
+                ss << "score(" << player_id << "):\t" << this->characters_[player_id].game_score_ << "\n";
+            }
+            for (int h = 0; h < H; h++)
+            {
+                for (int w = 0; w < W; w++)
+                {
+                    bool is_written = false; // 해당 좌표에 기록할 문자가 결정되었는지 여부
+                    for (int player_id = 0; player_id < this->characters_.size(); player_id++)
+                    {
+                        const auto &character = this->characters_[player_id];
+                        if (character.y_ == h && character.x_ == w)
+                        {
+                            if (player_id == 0)
+                            {
+                                ss << 'A';
+                            }
+                            else
+                            {
+                                ss << 'B';
+                            }
+                            is_written = true;
+                        }
+                    }
+                    if (!is_written)
+                    {
+                        if (this->points_[h][w] > 0)
+                        {
+                            ss << points_[h][w];
+                        }
+                        else
+                        {
+                            ss << '.';
+                        }
+                    }
+                }
+                ss << '\n';
+            }
+
+            return ss.str();
+        }
+    };
+
+    // 지정한 플레이어 행동을 무작위로 결정한다.
+    int randomAction(const SimultaneousMazeState &state, const int player_id)
+    {
+        auto legal_actions = state.legalActions(player_id);
+        return legal_actions[mt_for_action() % (legal_actions.size())];
+    }
+
+    // 플레이어 0 시점에서 평가
+    double playout(SimultaneousMazeState *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::FIRST):
+            return 1.;
+        case (WinningStatus::SECOND):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state, 0), randomAction(*state, 1));
+            return playout(state);
+        }
+    }
+}
+
+// 커넥트 포(8장)
+namespace connect_four
+{
+    constexpr const int H = 6; // 미로의 높이
+    constexpr const int W = 7; // 미로의 너비
+
+    using ScoreType = int64_t;
+    constexpr const ScoreType INF = 1000000000LL;
+
+    enum WinningStatus
+    {
+        WIN,
+        LOSE,
+        DRAW,
+        NONE,
+    };
+
+    class ConnectFourStateByBitSet
+    {
+    public:
+        static constexpr const int MAX_ACTION_NUMBER = W; // 한 턴에 가능한 행동 수의 최댓값
+
+    private:
+        uint64_t my_board_ = 0ULL;
+        uint64_t all_board_ = 0uLL;
+        bool is_first_ = true; // 선공 여부
+        WinningStatus winning_status_ = WinningStatus::NONE;
+
+        bool isWinner(const uint64_t board)
+        {
+            // 가로 방향으로 연속인가 판정한다.
+            uint64_t tmp_board = board & (board >> 7);
+            if ((tmp_board & (tmp_board >> 14)) != 0)
+            {
+                return true;
+            }
+            // "\"방향으로 연속인가 판정한다.
+            tmp_board = board & (board >> 6);
+            if ((tmp_board & (tmp_board >> 12)) != 0)
+            {
+                return true;
+            }
+            // "／"방향으로 연속인가 판정한다.
+            tmp_board = board & (board >> 8);
+            if ((tmp_board & (tmp_board >> 16)) != 0)
+            {
+                return true;
+            }
+            // 세로 방향으로 연속인가 판정한다.
+            tmp_board = board & (board >> 1);
+            if ((tmp_board & (tmp_board >> 2)) != 0)
+            {
+                return true;
+            }
+
+            return false;
+        }
+
+    public:
+        ConnectFourStateByBitSet() {}
+
+        bool isDone() const
+        {
+            return winning_status_ != WinningStatus::NONE;
+        }
+
+        void advance(const int action)
+        {
+            this->my_board_ ^= this->all_board_; // 상대방의 시점으로 바뀐다
+            is_first_ = !is_first_;
+            uint64_t new_all_board = this->all_board_ | (this->all_board_ + (1ULL << (action * 7)));
+            this->all_board_ = new_all_board;
+            uint64_t filled = 0b0111111011111101111110111111011111101111110111111ULL;
+
+            if (isWinner(this->my_board_ ^ this->all_board_))
+            {
+                this->winning_status_ = WinningStatus::LOSE;
+            }
+            else if (this->all_board_ == filled)
+            {
+                this->winning_status_ = WinningStatus::DRAW;
+            }
+        }
+        std::vector<int> legalActions() const
+        {
+            std::vector<int> actions;
+            uint64_t possible = this->all_board_ + 0b0000001000000100000010000001000000100000010000001ULL;
+            uint64_t filter = 0b0111111;
+            for (int x = 0; x < W; x++)
+            {
+                if ((filter & possible) != 0)
+                {
+                    actions.emplace_back(x);
+                }
+                filter <<= 7;
+            }
+            return actions;
+        }
+
+        // [플레이아웃 고속화] : 현재 플레이어가 가능한 행동을 actions에 기록하고 개수를 돌려준다.
+        int legalActions(int *actions) const
+        {
+            int action_number = 0;
+            uint64_t possible = this->all_board_ + 0b0000001000000100000010000001000000100000010000001ULL;
+            uint64_t filter = 0b0111111;
+            for (int x = 0; x < W; x++)
+            {
+                if ((filter & possible) != 0)
+                {
+                    actions[action_number++] = x;
+                }
+                filter <<= 7;
+            }
+            return action_number;
+        }
+
+        WinningStatus getWinningStatus() const
+        {
+            return this->winning_status_;
+        }
+
+        std::string toString() const
+        {
+            std::stringstream ss("");
+            ss << "is_first:\t" << this->is_first_ << "\n";
+            for (int y = H - 1; y >= 0; y--)
+            {
+                for (int x = 0; x < W; x++)
+                {
+                    int index = x * (H + 1) + y;
+                    char c = '.';
+                    if (((my_board_ >> index) & 1ULL) != 0)
+                    {
+                        c = (is_first_ ? 'x' : 'o');
+                    }
+                    else if ((((all_board_ ^ my_board_) >> index) & 1ULL) != 0)
+                    {
+                        c = (is_first_ ? 'o' : 'x');
+                    }
+                    ss << c;
+                }
+                ss << "\n";
+            }
+
+            return ss.str();
+        }
+    };
+
+    int randomActionBit(const ConnectFourStateByBitSet &state)
+    {
+        auto legal_actions = state.legalActions();
+        return legal_actions[mt_for_action() % (legal_actions.size())];
+    }
+
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(ConnectFourStateByBitSet *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomActionBit(*state));
+            return 1. - playout(state);
+        }
+    }
+}
+
+// 재귀와 행동 목록 할당 없이 플레이아웃하는 커널
+// 게임판 클래스에는 MAX_ACTION_NUMBER와 배열에 합법 수를 기록하는 legalActions가 필요하다.
+namespace playout_kernel
+{
+    // 교대로 두는 게임을 끝까지 무작위로 진행하고, 시작 시점 플레이어의 승패 점수를 계산한다.
+    template <class PlayoutState, class RandomEngine>
+    double iterativePlayout(PlayoutState *state, RandomEngine &mt)
+    {
+        using Status = decltype(state->getWinningStatus());
+        int actions[PlayoutState::MAX_ACTION_NUMBER];
+        int parity = 0; // 현재 플레이어가 시작 시점 플레이어의 상대방이면 1
+        while (!state->isDone())
+        {
+            const int action_number = state->legalActions(actions);
+            state->advance(actions[mt() % action_number]);
+            parity ^= 1;
+        }
+        double value = 0.5;
+        switch (state->getWinningStatus())
+        {
+        case (Status::WIN):
+            value = 1.;
+            break;
+        case (Status::LOSE):
+            value = 0.;
+            break;
+        default:
+            break;
+        }
+        return parity == 0 ? value : 1. - value;
+    }
+
+    // 동시에 두는 게임을 끝까지 무작위로 진행하고, 플레이어 0 시점의 승패 점수를 계산한다.
+    template <class PlayoutState, class RandomEngine>
+    double iterativeSimultaneousPlayout(PlayoutState *state, RandomEngine &mt)
+    {
+        using Status = decltype(state->getWinningStatus());
+        int actions0[PlayoutState::MAX_ACTION_NUMBER];
+        int actions1[PlayoutState::MAX_ACTION_NUMBER];
+        while (!state->isDone())
+        {
+            const int action_number0 = state->legalActions(0, actions0);
+            const int action_number1 = state->legalActions(1, actions1);
+            const int action0 = actions0[mt() % action_number0];
+            const int action1 = actions1[mt() % action_number1];
+            state->advance(action0, action1);
+        }
+        switch (state->getWinningStatus())
+        {
+        case (Status::FIRST):
+            return 1.;
+        case (Status::SECOND):
+            return 0.;
+        default:
+            return 0.5;
+        }
+    }
+}
+
+// 같은 게임판에서 두 플레이아웃 함수를 playout_number번씩 실행하고 평균 점수가 같은지 확인한다.
+template <class PlayoutState, class RecursivePlayout, class IterativePlayout>
+void testPlayoutValue(const std::string &name, const PlayoutState &state, const RecursivePlayout &recursive_playout, const IterativePlayout &iterative_playout, const int playout_number)
+{
+    using std::cout;
+    using std::endl;
+    double recursive_value = 0;
+    double iterative_value = 0;
+    for (int i = 0; i < playout_number; i++)
+    {
+        PlayoutState recursive_state = state;
+        recursive_value += recursive_playout(&recursive_state);
+        PlayoutState iterative_state = state;
+        iterative_value += iterative_playout(&iterative_state);
+    }
+    cout << name << ":\trecursive " << recursive_value / playout_number << "\titerative " << iterative_value / playout_number << endl;
+}
+
+// 제한 시간(밀리초) 동안 같은 게임판에서 플레이아웃을 반복하고, 초당 플레이아웃 횟수를 표시한다.
+template <class PlayoutState, class PlayoutFunction>
+void testPlayoutSpeed(const std::string &name, const PlayoutState &state, const PlayoutFunction &playout, const int64_t time_threshold)
+{
+    using std::cout;
+    using std::endl;
+    auto time_keeper = TimeKeeper(time_threshold);
+    int64_t playout_count = 0;
+    while (!time_keeper.isTimeOver())
+    {
+        PlayoutState state_copy = state;
+        playout(&state_copy);
+        ++playout_count;
+    }
+    cout << name << ":\t" << playout_count * 1000 / time_threshold << " playouts/sec" << endl;
+}
+
+int main()
+{
+    using playout_kernel::iterativePlayout;
+    using playout_kernel::iterativeSimultaneousPlayout;
+
+    const auto alternate_state = alternate::AlternateMazeState(0);
+    const auto simultaneous_state = simultaneous::SimultaneousMazeState(0);
+    const auto connect_four_state = connect_four::ConnectFourStateByBitSet();
+    auto alternate_iterative = [](alternate::AlternateMazeState *state)
+    { return iterativePlayout(state, mt_for_action); };
+    auto simultaneous_iterative = [](simultaneous::SimultaneousMazeState *state)
+    { return iterativeSimultaneousPlayout(state, mt_for_action); };
+    auto connect_four_iterative = [](connect_four::ConnectFourStateByBitSet *state)
+    { return iterativePlayout(state, mt_for_action); };
+
+    // 재귀 플레이아웃과 같은 분포의 결과가 나오는지 확인한다.
+    testPlayoutValue("AlternateMazeState", alternate_state, alternate::playout, alternate_iterative, 100000);
+    testPlayoutValue("SimultaneousMazeState", simultaneous_state, simultaneous::playout, simultaneous_iterative, 100000);
+    testPlayoutValue("ConnectFourStateByBitSet", connect_four_state, connect_four::playout, connect_four_iterative, 100000);
+
+    testPlayoutSpeed("AlternateMazeState recursive", alternate_state, alternate::playout, 1000);
+    testPlayoutSpeed("AlternateMazeState iterative", alternate_state, alternate_iterative, 1000);
+    testPlayoutSpeed("SimultaneousMazeState recursive", simultaneous_state, simultaneous::playout, 1000);
+    testPlayoutSpeed("SimultaneousMazeState iterative", simultaneous_state, simultaneous_iterative, 1000);
+    testPlayoutSpeed("ConnectFourStateByBitSet recursive", connect_four_state, connect_four::playout, 1000);
+    testPlayoutSpeed("ConnectFourStateByBitSet iterative", connect_four_state, connect_four_iterative, 1000);
+    return 0;
+}
@@ -0,0 +1,666 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <sstream>
+#include <random>
+#include <iostream>
+#include <queue>
+#include <chrono>
+#include <functional>
+#include <unordered_set>
+#include <vector>
+#include <algorithm>
+#include <new>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#endif
+// 좌표를 저장하는 구조체
+struct Coord
+{
+    int y_;
+    int x_;
+    Coord(const int y = 0, const int x = 0) : y_(y), x_(x) {}
+};
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+std::mt19937 mt_for_action(0);                // 행동 선택용 난수 생성기 초기화
+using ScoreType = int64_t;                    // 게임 평가 점수 자료형을 결정
+constexpr const ScoreType INF = 1000000000LL; // 불가능한(무한) 점수의 예로 정의
+
+constexpr const int H = 7;   // 미로의 높이
+constexpr const int W = 7;   // 미로의 너비
+constexpr int END_TURN = 49; // 게임 종료 턴
+
+namespace zobrist_hash
+{
+    std::mt19937 mt_init_hash(0);
+    // 벽 위치는 고정이므로 해시 관리하지 않음
+    uint64_t points[H][W][9 + 1] = {}; // 숫자 그대로 이용할 수 있도록 1을 더함
+    uint64_t character[H][W] = {};
+    void init()
+    {
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                for (int p = 1; p < 9 + 1; p++)
+                {
+                    points[y][x][p] = mt_init_hash();
+                }
+                character[y][x] = mt_init_hash();
+            }
+    }
+
+}
+
+// 1인 게임 예
+// 1턴에 상하좌우 네 방향 중 하나로 벽이 없는 장소로 한 칸 이동한다.
+// 바닥에 있는 점수를 차지하면 자신의 점수가 되고, 바닥의 점수는 사라진다.
+// END_TURN 시점에 높은 점수를 얻는 것이 목적
+class WallMazeState
+{
+private:
+    static constexpr const int dx[4] = {1, -1, 0, 0}; // 오른쪽, 왼쪽, 아래쪽, 위쪽으로 이동하는 이동방향 x축 값
+    static constexpr const int dy[4] = {0, 0, 1, -1}; // 오른쪽, 왼쪽, 아래쪽, 위쪽으로 이동하는 이동방향 y축 값
+
+    int points_[H][W] = {}; // 바닥의 점수는 1~9 중 하나
+    int turn_ = 0;          // 현재 턴
+    int walls_[H][W] = {};
+
+    struct DistanceCoord
+    {
+        int y_;
+        int x_;
+        int distance_;
+        DistanceCoord() : y_(0), x_(0), distance_(0) {}
+        DistanceCoord(const int y, const int x, const int distance) : y_(y), x_(x), distance_(distance) {}
+        DistanceCoord(const Coord &coord) : y_(coord.y_), x_(coord.x_), distance_(0) {}
+    };
+
+    // 너비 우선 탐색으로 가장 가까운 점수가 있는 바닥까지 거리를 계산한다.
+    int getDistanceToNearestPoint()
+    {
+        auto que = std::deque<DistanceCoord>();
+        que.emplace_back(this->character_);
+        std::vector<std::vector<bool>> check(H, std::vector<bool>(W, false));
+        while (!que.empty())
+        {
+            const auto &tmp_cod = que.front();
+            que.pop_front();
+            if (this->points_[tmp_cod.y_][tmp_cod.x_] > 0)
+            {
+                return tmp_cod.distance_;
+            }
+            check[tmp_cod.y_][tmp_cod.x_] = true;
+
+            for (int action = 0; action < 4; action++)
+            {
+                int ty = tmp_cod.y_ + dy[action];
+                int tx = tmp_cod.x_ + dx[action];
+
+                if (ty >= 0 && ty < H && tx >= 0 && tx < W && !this->walls_[ty][tx] && !check[ty][tx])
+                {
+                    que.emplace_back(ty, tx, tmp_cod.distance_ + 1);
+                }
+            }
+        }
+        return H * W;
+    }
+
+    //  zobrist_hash용
+    void init_hash()
+    {
+        hash_ = 0;
+        hash_ ^= zobrist_hash::character[character_.y_][character_.x_];
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                auto point = points_[y][x];
+                if (point > 0)
+                {
+                    hash_ ^= zobrist_hash::points[y][x][point];
+                }
+            }
+    }
+
+public:
+    Coord character_ = Coord();
+    int game_score_ = 0;            // 게임에서 획득한 점수
+    ScoreType evaluated_score_ = 0; // 탐색을 통해 확인한 점수
+    int first_action_ = -1;         // 탐색 트리의 루트 노드에서 처음으로 선택한 행동
+    uint64_t hash_ = 0;             // 동일 게임판 판정에 사용하는 해시
+    WallMazeState() {}
+
+    // h*w 크기의 미로를 생성한다.
+    WallMazeState(const int seed)
+    {
+        auto mt_for_construct = std::mt19937(seed); // 게임판 구성용 난수 생성기 초기화
+
+        this->character_.y_ = mt_for_construct() % H;
+        this->character_.x_ = mt_for_construct() % W;
+
+        // 기둥 쓰러뜨리기 알고리즘으로 생성한다.
+        for (int y = 1; y < H; y += 2)
+            for (int x = 1; x < W; x += 2)
+            {
+                int ty = y;
+                int tx = x;
+                // 이때 (ty,tx)는 1칸씩 건너뛴 위치
+                if (ty == character_.y_ && tx == character_.x_)
+                {
+                    continue;
+                }
+                this->walls_[ty][tx] = 1;
+                int direction_size = 3; // (오른쪽, 왼쪽, 아래쪽) 방향의 근접한 칸을 벽후보로 한다.
+                if (y == 1)
+                {
+                    direction_size = 4; // 첫 행만 위쪽 방향의 근접한 칸도 벽 후보에 들어간다.
+                }
+                int direction = mt_for_construct() % direction_size;
+                ty += dy[direction];
+                tx += dx[direction];
+                // 이때 (ty,tx)는 1칸씩 건너뛴 위치에서 무작위로 이동한 인접한 위치
+                if (ty == character_.y_ && tx == character_.x_)
+                {
+                    continue;
+                }
+                this->walls_[ty][tx] = 1;
+            }
+
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+            {
+                if (y == character_.y_ && x == character_.x_)
+                {
+                    continue;
+                }
+
+                this->points_[y][x] = mt_for_construct() % 10;
+            }
+        this->init_hash();
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return this->turn_ == END_TURN;
+    }
+    // [모든 게임에서 구현] : 탐색용으로 게임판을 평가한다.
+    void evaluateScore()
+    {
+        this->evaluated_score_ = this->game_score_ * H * W - getDistanceToNearestPoint(); // 평가에 거리 정보를 더한다.
+    }
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행한다.
+    void advance(const int action)
+    {
+        hash_ ^= zobrist_hash::character[character_.y_][character_.x_]; // 현재 캐릭터 위치 정보를 제거
+        this->character_.x_ += dx[action];
+        this->character_.y_ += dy[action];
+        auto &point = this->points_[this->character_.y_][this->character_.x_];
+        hash_ ^= zobrist_hash::character[character_.y_][character_.x_]; // 이동할 캐릭터 위치 정보를 추가
+        if (point > 0)
+        {
+            hash_ ^= zobrist_hash::points[character_.y_][character_.x_][point]; // 점수가 없어진 것을 해시에 반영
+            this->game_score_ += point;
+            point = 0;
+        }
+        this->turn_++;
+    }
+
+    // [모든 게임에서 구현] : 현재 상황에서 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        for (int action = 0; action < 4; action++)
+        {
+            int ty = this->character_.y_ + dy[action];
+            int tx = this->character_.x_ + dx[action];
+            if (ty >= 0 && ty < H && tx >= 0 && tx < W && this->walls_[ty][tx] == 0)
+            {
+                actions.emplace_back(action);
+            }
+        }
+        return actions;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss;
+        ss << "turn:\t" << this->turn_ << "\n";
+        ss << "score:\t" << this->game_score_ << "\n";
+        for (int h = 0; h < H; h++)
+        {
+            for (int w = 0; w < W; w++)
+            {
+                if (this->walls_[h][w] == 1)
+                {
+                    ss << '#';
+                }
+                else if (this->character_.y_ == h && this->character_.x_ == w)
+                {
+                    ss << '@';
+                }
+                else if (this->points_[h][w] > 0)
+                {
+                    ss << points_[h][w];
+                }
+                else
+                {
+                    ss << '.';
+                }
+            }
+            ss << '\n';
+        }
+
+        return ss.str();
+    }
+};
+
+// [모든 게임에서 구현] : 탐색할 때 정렬용으로 평가를 비교한다.
+bool operator<(const WallMazeState &maze_1, const WallMazeState &maze_2)
+{
+    return maze_1.evaluated_score_ < maze_2.evaluated_score_;
+}
+
+using State = WallMazeState;
+
+
+// 큰 탐색 버퍼를 휴지 페이지(2MiB)와 NUMA 로컬 메모리에 배치하기 위한 메모리 할당
+// 휴지 페이지를 쓸 수 없는 환경에서는 일반 페이지로 자동으로 되돌아간다.
+namespace page_memory
+{
+    enum class PagePolicy
+    {
+        DEFAULT,               // 표준 할당(operator new)
+        TRANSPARENT_HUGE_PAGE, // 2MiB 정렬로 mmap하고 madvise(MADV_HUGEPAGE)로 투명 휴지 페이지를 요청한다.
+        EXPLICIT_HUGE_PAGE,    // MAP_HUGETLB로 미리 확보된 휴지 페이지를 사용한다. 실패하면 투명 휴지 페이지로 되돌아간다.
+    };
+
+    struct PageOptions
+    {
+        PagePolicy policy_ = PagePolicy::DEFAULT;
+        bool numa_local_ = false; // 할당한 스레드가 있는 NUMA 노드에 페이지를 배치한다.
+    };
+
+    constexpr const size_t HUGE_PAGE_SIZE = 2 << 20;         // 휴지 페이지 크기
+    constexpr const size_t MIN_MAPPED_SIZE = HUGE_PAGE_SIZE; // 이보다 작은 할당은 휴지 페이지의 이점이 없으므로 표준 할당을 사용한다.
+
+    PageOptions page_options; // 기본 생성한 PageAllocator가 사용하는 설정
+
+    // 실제로 사용한 할당 방식을 센다.
+    struct PageStatistics
+    {
+        int64_t explicit_huge_page_number_ = 0;
+        int64_t transparent_huge_page_number_ = 0;
+        int64_t fallback_number_ = 0; // 휴지 페이지를 요청했지만 얻지 못한 횟수
+    };
+    PageStatistics page_statistics;
+
+    size_t mappedSize(const size_t bytes)
+    {
+        return (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    }
+
+    bool isMapped(const PageOptions &options, const size_t bytes)
+    {
+        return options.policy_ != PagePolicy::DEFAULT && bytes >= MIN_MAPPED_SIZE;
+    }
+
+#ifdef __linux__
+    // HUGE_PAGE_SIZE로 정렬된 익명 메모리를 mmap한다. 앞뒤의 정렬용 여분은 해제한다.
+    void *mapAligned(const size_t size)
+    {
+        void *raw = mmap(nullptr, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED)
+        {
+            return nullptr;
+        }
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t aligned = (begin + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        if (aligned > begin)
+        {
+            munmap(raw, aligned - begin);
+        }
+        const uintptr_t tail = begin + size + HUGE_PAGE_SIZE - (aligned + size);
+        if (tail > 0)
+        {
+            munmap(reinterpret_cast<void *>(aligned + size), tail);
+        }
+        return reinterpret_cast<void *>(aligned);
+    }
+#endif
+
+    // bytes 바이트를 할당한다. 큰 할당만 설정에 따라 mmap으로 확보한다.
+    void *allocate(const PageOptions &options, const size_t bytes)
+    {
+        if (!isMapped(options, bytes))
+        {
+            return ::operator new(bytes);
+        }
+#ifdef __linux__
+        const size_t size = mappedSize(bytes);
+        void *memory = nullptr;
+        if (options.policy_ == PagePolicy::EXPLICIT_HUGE_PAGE)
+        {
+            memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (memory == MAP_FAILED)
+            {
+                memory = nullptr;
+                ++page_statistics.fallback_number_;
+            }
+            else
+            {
+                ++page_statistics.explicit_huge_page_number_;
+            }
+        }
+        if (memory == nullptr)
+        {
+            memory = mapAligned(size);
+            if (memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            if (madvise(memory, size, MADV_HUGEPAGE) == 0)
+            {
+                ++page_statistics.transparent_huge_page_number_;
+            }
+            else
+            { // 투명 휴지 페이지를 지원하지 않는 커널에서는 일반 페이지로 사용한다.
+                ++page_statistics.fallback_number_;
+            }
+        }
+        if (options.numa_local_)
+        { // 아직 물리 페이지가 없는 상태에서 MPOL_LOCAL을 지정하고 이 스레드에서 먼저 접근해서 페이지를 이 스레드의 노드에 배치한다.
+            syscall(SYS_mbind, memory, size, MPOL_LOCAL, nullptr, 0, 0);
+            for (size_t offset = 0; offset < size; offset += 4096)
+            {
+                static_cast<volatile char *>(memory)[offset] = 0;
+            }
+        }
+        return memory;
+#else
+        return ::operator new(bytes);
+#endif
+    }
+
+    // allocate로 확보한 메모리를 해제한다. 같은 설정과 크기를 지정해야 한다.
+    void deallocate(const PageOptions &options, void *memory, const size_t bytes)
+    {
+#ifdef __linux__
+        if (isMapped(options, bytes))
+        {
+            munmap(memory, mappedSize(bytes));
+            return;
+        }
+#endif
+        ::operator delete(memory);
+    }
+
+    // std::vector 등에 지정하는 할당자
+    // 생성할 때의 page_options를 기억해서, 설정을 바꾸어도 이미 만든 컨테이너는 같은 방식으로 해제한다.
+    template <class T>
+    class PageAllocator
+    {
+    public:
+        using value_type = T;
+        PageOptions options_;
+
+        PageAllocator() : options_(page_options) {}
+        template <class U>
+        PageAllocator(const PageAllocator<U> &other) : options_(other.options_) {}
+
+        T *allocate(const size_t n)
+        {
+            return static_cast<T *>(page_memory::allocate(this->options_, n * sizeof(T)));
+        }
+
+        void deallocate(T *memory, const size_t n)
+        {
+            page_memory::deallocate(this->options_, memory, n * sizeof(T));
+        }
+
+        template <class U>
+        bool operator==(const PageAllocator<U> &other) const
+        {
+            return this->options_.policy_ == other.options_.policy_ && this->options_.numa_local_ == other.options_.numa_local_;
+        }
+        template <class U>
+        bool operator!=(const PageAllocator<U> &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    std::string toString(const PageOptions &options)
+    {
+        std::string name;
+        switch (options.policy_)
+        {
+        case (PagePolicy::DEFAULT):
+            name = "default";
+            break;
+        case (PagePolicy::TRANSPARENT_HUGE_PAGE):
+            name = "transparent huge page";
+            break;
+        case (PagePolicy::EXPLICIT_HUGE_PAGE):
+            name = "explicit huge page";
+            break;
+        }
+        if (options.numa_local_)
+        {
+            name += " + numa local";
+        }
+        return name;
+    }
+
+    // 비교에 사용하는 설정 목록
+    const std::vector<PageOptions> all_page_options = {
+        {PagePolicy::DEFAULT, false},
+        {PagePolicy::TRANSPARENT_HUGE_PAGE, false},
+        {PagePolicy::EXPLICIT_HUGE_PAGE, false},
+        {PagePolicy::TRANSPARENT_HUGE_PAGE, true},
+    };
+}
+
+// 빔 너비와 깊이를 지정해서 빔 탐색으로 행동을 결정한다.
+int beamSearchAction(const State &state, const int beam_width, const int beam_depth)
+{
+    std::priority_queue<State> now_beam;
+    State best_state;
+
+    now_beam.push(state);
+    auto hash_check = std::unordered_set<uint64_t>();
+
+    for (int t = 0; t < beam_depth; t++)
+    {
+        std::priority_queue<State> next_beam;
+        for (int i = 0; i < beam_width; i++)
+        {
+            if (now_beam.empty())
+                break;
+            State now_state = now_beam.top();
+            now_beam.pop();
+            auto legal_actions = now_state.legalActions();
+            for (const auto &action : legal_actions)
+            {
+                State next_state = now_state;
+                next_state.advance(action);
+                if (t >= 1 && hash_check.count(next_state.hash_) > 0)
+                {
+                    continue;
+                }
+                hash_check.emplace(next_state.hash_);
+                next_state.evaluateScore();
+                if (t == 0)
+                    next_state.first_action_ = action;
+                next_beam.push(next_state);
+            }
+        }
+
+        now_beam = next_beam;
+        best_state = now_beam.top();
+
+        if (best_state.isDone())
+        {
+            break;
+        }
+    }
+    return best_state.first_action_;
+}
+
+
+using BeamBuffer = std::vector<State, page_memory::PageAllocator<State>>;
+
+// 빔 너비와 깊이를 지정해서 빔 탐색으로 행동을 결정한다.
+// 빔을 호출할 때마다 새로 만들지 않고, 호출하는 쪽이 준비한 버퍼를 힙으로 사용한다.
+// 버퍼에 beam_width * 4 이상을 확보해 두면 탐색 중에는 할당이 일어나지 않는다.
+int beamSearchAction(const State &state, const int beam_width, const int beam_depth, BeamBuffer &now_beam, BeamBuffer &next_beam)
+{
+    State best_state;
+
+    now_beam.clear();
+    now_beam.emplace_back(state);
+    auto hash_check = std::unordered_set<uint64_t>();
+
+    for (int t = 0; t < beam_depth; t++)
+    {
+        next_beam.clear();
+        for (int i = 0; i < beam_width; i++)
+        {
+            if (now_beam.empty())
+                break;
+            std::pop_heap(now_beam.begin(), now_beam.end());
+            State now_state = now_beam.back();
+            now_beam.pop_back();
+            auto legal_actions = now_state.legalActions();
+            for (const auto &action : legal_actions)
+            {
+                State next_state = now_state;
+                next_state.advance(action);
+                if (t >= 1 && hash_check.count(next_state.hash_) > 0)
+                {
+                    continue;
+                }
+                hash_check.emplace(next_state.hash_);
+                next_state.evaluateScore();
+                if (t == 0)
+                    next_state.first_action_ = action;
+                next_beam.emplace_back(next_state);
+                std::push_heap(next_beam.begin(), next_beam.end());
+            }
+        }
+
+        std::swap(now_beam, next_beam);
+        best_state = now_beam.front();
+
+        if (best_state.isDone())
+        {
+            break;
+        }
+    }
+    return best_state.first_action_;
+}
+using AIFunction = std::function<int(const State &)>;
+using StringAIPair = std::pair<std::string, AIFunction>;
+
+// 게임을 game_number횟수만큼 플레이해서 평균 점수를 표시한다.
+void testAiScore(const StringAIPair &ai, const int game_number)
+{
+    using std::cout;
+    using std::endl;
+    std::mt19937 mt_for_construct(0);
+    double score_mean = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(mt_for_construct());
+
+        while (!state.isDone())
+        {
+            state.advance(ai.second(state));
+        }
+        auto score = state.game_score_;
+        score_mean += score;
+    }
+    score_mean /= (double)game_number;
+    cout << "Score of " << ai.first << ":\t" << score_mean << endl;
+}
+
+// game_number종류의 게임판을 per_game_number회 처리하는데 걸린 평균 시간(밀리초)을 측정해서 표시한다.
+void testAiSpeed(const StringAIPair &ai, const int game_number, const int per_game_number)
+{
+    using std::cout;
+    using std::endl;
+    std::mt19937 mt_for_construct(0);
+    std::chrono::high_resolution_clock::time_point diff_sum;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State(mt_for_construct());
+        auto start_time = std::chrono::high_resolution_clock::now();
+        for (int j = 0; j < per_game_number; j++)
+        {
+            ai.second(state);
+        }
+        auto diff = std::chrono::high_resolution_clock::now() - start_time;
+        diff_sum += diff;
+    }
+    double time_mean = std::chrono::duration_cast<std::chrono::milliseconds>(diff_sum.time_since_epoch()).count() / (double)(game_number);
+    cout << "Time of " << ai.first << ":\t" << time_mean << "ms" << endl;
+}
+
+// 할당 설정마다 빔 탐색의 실행 시간을 표시한다.
+void testPageOptions(const int beam_width, const int game_number, const int per_game_number)
+{
+    testAiSpeed(StringAIPair("beamSearchAction width " + std::to_string(beam_width) + " (std::priority_queue)", [&](const State &state)
+                             { return beamSearchAction(state, beam_width, END_TURN); }),
+                game_number, per_game_number);
+    for (const auto &options : page_memory::all_page_options)
+    {
+        page_memory::page_options = options;
+        BeamBuffer now_beam;
+        BeamBuffer next_beam;
+        now_beam.reserve(beam_width * 4);
+        next_beam.reserve(beam_width * 4);
+        const auto &ai = StringAIPair("beamSearchAction width " + std::to_string(beam_width) + " (" + page_memory::toString(options) + ")", [&](const State &state)
+                                      { return beamSearchAction(state, beam_width, END_TURN, now_beam, next_beam); });
+        testAiSpeed(ai, game_number, per_game_number);
+    }
+    page_memory::page_options = page_memory::PageOptions();
+}
+
+int main()
+{
+    using std::cout;
+    using std::endl;
+    zobrist_hash::init(); // 반드시 시작할 때 호출한다.
+    testPageOptions(100, /*게임 횟수*/ 100, 10);
+    testPageOptions(2000, /*게임 횟수*/ 10, 1);
+    const auto &stats = page_memory::page_statistics;
+    cout << "explicit huge page " << stats.explicit_huge_page_number_
+         << ", transparent huge page " << stats.transparent_huge_page_number_
+         << ", fallback " << stats.fallback_number_ << endl;
+    return 0;
+}
@@ -0,0 +1,687 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <array>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+#include <queue>
+#include <set>
+#include <type_traits>
+#pragma GCC diagnostic ignored "-Wsign-compare"
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+constexpr const int H = 6; // 미로의 높이
+constexpr const int W = 7; // 미로의 너비
+
+using ScoreType = int64_t;
+constexpr const ScoreType INF = 1000000000LL;
+
+enum WinningStatus
+{
+    WIN,
+    LOSE,
+    DRAW,
+    NONE,
+};
+
+class ConnectFourState
+{
+private:
+    static constexpr const int dx[2] = {1, -1};          // 이동 방향의 x성분
+    static constexpr const int dy_right_up[2] = {1, -1}; // /"／"대각선 방향의 x성분
+    static constexpr const int dy_left_up[2] = {-1, 1};  // "\"대각선 방향의 x성분
+    static constexpr const int dy[4] = {0, 0, 1, -1};    // 오른쪽, 왼쪽, 위쪽, 아래쪽 이동 방향의 y성분
+
+    WinningStatus winning_status_ = WinningStatus::NONE;
+
+public:
+    bool is_first_ = true; // 선공 여부
+    int my_board_[H][W] = {};
+    int enemy_board_[H][W] = {};
+
+    ConnectFourState()
+    {
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return winning_status_ != WinningStatus::NONE;
+    }
+
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+    void advance(const int action)
+    {
+        std::pair<int, int> coordinate;
+        for (int y = 0; y < H; y++)
+        {
+            if (this->my_board_[y][action] == 0 && this->enemy_board_[y][action] == 0)
+            {
+                this->my_board_[y][action] = 1;
+                coordinate = std::pair<int, int>(y, action);
+                break;
+            }
+        }
+
+        { // 가로 방향으로 연속인가 판정한다.
+
+            auto que = std::deque<std::pair<int, int>>();
+            que.emplace_back(coordinate);
+            std::vector<std::vector<bool>> check(H, std::vector<bool>(W, false));
+            int count = 0;
+            while (!que.empty())
+            {
+                const auto &tmp_cod = que.front();
+                que.pop_front();
+                ++count;
+                if (count >= 4)
+                {
+                    this->winning_status_ = WinningStatus::LOSE; // 자신의 돌이 연속이면 상대방의 패배
+                    break;
+                }
+                check[tmp_cod.first][tmp_cod.second] = true;
+
+                for (int action = 0; action < 2; action++)
+                {
+                    int ty = tmp_cod.first;
+                    int tx = tmp_cod.second + dx[action];
+
+                    if (ty >= 0 && ty < H && tx >= 0 && tx < W && my_board_[ty][tx] == 1 && !check[ty][tx])
+                    {
+                        que.emplace_back(ty, tx);
+                    }
+                }
+            }
+        }
+        if (!isDone())
+        { // "／"방향으로 연속인가 판정한다.
+            auto que = std::deque<std::pair<int, int>>();
+            que.emplace_back(coordinate);
+            std::vector<std::vector<bool>> check(H, std::vector<bool>(W, false));
+            int count = 0;
+            while (!que.empty())
+            {
+                const auto &tmp_cod = que.front();
+                que.pop_front();
+                ++count;
+                if (count >= 4)
+                {
+                    this->winning_status_ = WinningStatus::LOSE; // 자신의 돌이 연속이면 상대방의 패배
+                    break;
+                }
+                check[tmp_cod.first][tmp_cod.second] = true;
+
+                for (int action = 0; action < 2; action++)
+                {
+                    int ty = tmp_cod.first + dy_right_up[action];
+                    int tx = tmp_cod.second + dx[action];
+
+                    if (ty >= 0 && ty < H && tx >= 0 && tx < W && my_board_[ty][tx] == 1 && !check[ty][tx])
+                    {
+                        que.emplace_back(ty, tx);
+                    }
+                }
+            }
+        }
+
+        if (!isDone())
+        { // "\"방향으로 연속인가 판정한다.
+
+            auto que = std::deque<std::pair<int, int>>();
+            que.emplace_back(coordinate);
+            std::vector<std::vector<bool>> check(H, std::vector<bool>(W, false));
+            int count = 0;
+            while (!que.empty())
+            {
+                const auto &tmp_cod = que.front();
+                que.pop_front();
+                ++count;
+                if (count >= 4)
+                {
+                    this->winning_status_ = WinningStatus::LOSE; // 자신의 돌이 연속이면 상대방의 패배
+                    break;
+                }
+                check[tmp_cod.first][tmp_cod.second] = true;
+
+                for (int action = 0; action < 2; action++)
+                {
+                    int ty = tmp_cod.first + dy_left_up[action];
+                    int tx = tmp_cod.second + dx[action];
+
+                    if (ty >= 0 && ty < H && tx >= 0 && tx < W && my_board_[ty][tx] == 1 && !check[ty][tx])
+                    {
+                        que.emplace_back(ty, tx);
+                    }
+                }
+            }
+        }
+        if (!isDone())
+        { // 세로 방향으로 연속인가 판정한다.
+
+            int ty = coordinate.first;
+            int tx = coordinate.second;
+            bool is_win = true;
+            for (int i = 0; i < 4; i++)
+            {
+                bool is_mine = (ty >= 0 && ty < H && tx >= 0 && tx < W && my_board_[ty][tx] == 1);
+
+                if (!is_mine)
+                {
+                    is_win = false;
+                    break;
+                }
+                --ty;
+            }
+            if (is_win)
+            {
+                this->winning_status_ = WinningStatus::LOSE; // 자신의 돌이 연속이면 상대방의 패배
+            }
+        }
+
+        std::swap(my_board_, enemy_board_);
+        is_first_ = !is_first_;
+        if (this->winning_status_ == WinningStatus::NONE && legalActions().size() == 0)
+        {
+            this->winning_status_ = WinningStatus::DRAW;
+        }
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        for (int x = 0; x < W; x++)
+            for (int y = H - 1; y >= 0; y--)
+            {
+                if (my_board_[y][x] == 0 && enemy_board_[y][x] == 0)
+                {
+                    actions.emplace_back(x);
+                    break;
+                }
+            }
+        return actions;
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        return this->winning_status_;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+    double getFirstPlayerScoreForWinRate() const
+    {
+        switch (this->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            if (this->is_first_)
+            {
+                return 1.;
+            }
+            else
+            {
+                return 0.;
+            }
+        case (WinningStatus::LOSE):
+            if (this->is_first_)
+            {
+                return 0.;
+            }
+            else
+            {
+                return 1.;
+            }
+        default:
+            return 0.5;
+        }
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss("");
+
+        ss << "is_first:\t" << this->is_first_ << "\n";
+        for (int y = H - 1; y >= 0; y--)
+        {
+            for (int x = 0; x < W; x++)
+            {
+                char c = '.';
+                if (my_board_[y][x] == 1)
+                {
+                    c = (is_first_ ? 'x' : 'o');
+                }
+                else if (enemy_board_[y][x] == 1)
+                {
+                    c = (is_first_ ? 'o' : 'x');
+                }
+                ss << c;
+            }
+            ss << "\n";
+        }
+
+        return ss.str();
+    }
+};
+
+
+// 게임판 크기에 맞는 비트보드 자료형을 고른다.
+// 각 열은 돌이 올라갈 Height 비트와 보초 1비트를 사용하므로 Width*(Height+1) 비트가 필요하다.
+template <int Width, int Height>
+using BitBoardType = typename std::conditional<(Width * (Height + 1) <= 64), uint64_t, unsigned __int128>::type;
+
+// 게임판 크기를 템플릿 인자로 받는 비트보드 ConnectFour
+// 마스크와 시프트량은 모두 컴파일 시점에 Width, Height에서 계산한다.
+template <int Width, int Height>
+class ConnectFourBitBoardState
+{
+    static_assert(Width * (Height + 1) <= 128, "게임판이 128비트에 들어가지 않습니다.");
+
+public:
+    using Board = BitBoardType<Width, Height>;
+
+private:
+    static constexpr const int HORIZONTAL_SHIFT = Height + 1; // 가로 방향(열 하나의 비트 수)
+    static constexpr const int DOWN_RIGHT_SHIFT = Height;     // "\"방향
+    static constexpr const int UP_RIGHT_SHIFT = Height + 2;   // "／"방향
+    static constexpr const int VERTICAL_SHIFT = 1;            // 세로 방향
+
+    // 각 열의 가장 아래 칸에만 비트가 선 마스크
+    static constexpr Board bottomMask()
+    {
+        Board mask = 0;
+        for (int x = 0; x < Width; x++)
+        {
+            mask |= Board(1) << (x * HORIZONTAL_SHIFT);
+        }
+        return mask;
+    }
+    static constexpr const Board BOTTOM_MASK = bottomMask();
+    static constexpr const Board COLUMN_MASK = (Board(1) << Height) - 1; // 0번째 열의 모든 칸
+    static constexpr const Board FILLED = BOTTOM_MASK * COLUMN_MASK;      // 모든 열이 가득 찬 게임판
+
+    Board my_board_ = 0;
+    Board all_board_ = 0;
+    bool is_first_ = true; // 선공 여부
+    WinningStatus winning_status_ = WinningStatus::NONE;
+
+    static bool isWinner(const Board board)
+    {
+        // 가로 방향으로 연속인가 판정한다.
+        Board tmp_board = board & (board >> HORIZONTAL_SHIFT);
+        if ((tmp_board & (tmp_board >> (2 * HORIZONTAL_SHIFT))) != 0)
+        {
+            return true;
+        }
+        // "\"방향으로 연속인가 판정한다.
+        tmp_board = board & (board >> DOWN_RIGHT_SHIFT);
+        if ((tmp_board & (tmp_board >> (2 * DOWN_RIGHT_SHIFT))) != 0)
+        {
+            return true;
+        }
+        // "／"방향으로 연속인가 판정한다.
+        tmp_board = board & (board >> UP_RIGHT_SHIFT);
+        if ((tmp_board & (tmp_board >> (2 * UP_RIGHT_SHIFT))) != 0)
+        {
+            return true;
+        }
+        // 세로 방향으로 연속인가 판정한다.
+        tmp_board = board & (board >> VERTICAL_SHIFT);
+        if ((tmp_board & (tmp_board >> (2 * VERTICAL_SHIFT))) != 0)
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+public:
+    ConnectFourBitBoardState() {}
+
+    // 같은 크기의 ConnectFourState에서만 변환할 수 있다.
+    ConnectFourBitBoardState(const ConnectFourState &state) : is_first_(state.is_first_)
+    {
+        static_assert(Width == W && Height == H, "ConnectFourState와 게임판 크기가 다릅니다.");
+        for (int y = 0; y < Height; y++)
+        {
+            for (int x = 0; x < Width; x++)
+            {
+                int index = x * HORIZONTAL_SHIFT + y;
+                if (state.my_board_[y][x] == 1)
+                {
+                    this->my_board_ |= Board(1) << index;
+                }
+                if (state.my_board_[y][x] == 1 || state.enemy_board_[y][x] == 1)
+                {
+                    this->all_board_ |= Board(1) << index;
+                }
+            }
+        }
+    }
+
+    bool isDone() const
+    {
+        return winning_status_ != WinningStatus::NONE;
+    }
+
+    void advance(const int action)
+    {
+        this->my_board_ ^= this->all_board_; // 상대방의 시점으로 바뀐다
+        is_first_ = !is_first_;
+        this->all_board_ |= this->all_board_ + (Board(1) << (action * HORIZONTAL_SHIFT));
+
+        if (isWinner(this->my_board_ ^ this->all_board_))
+        {
+            this->winning_status_ = WinningStatus::LOSE;
+        }
+        else if (this->all_board_ == FILLED)
+        {
+            this->winning_status_ = WinningStatus::DRAW;
+        }
+    }
+
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        Board possible = this->all_board_ + BOTTOM_MASK;
+        Board filter = COLUMN_MASK;
+        for (int x = 0; x < Width; x++)
+        {
+            if ((filter & possible) != 0)
+            {
+                actions.emplace_back(x);
+            }
+            filter <<= HORIZONTAL_SHIFT;
+        }
+        return actions;
+    }
+
+    WinningStatus getWinningStatus() const
+    {
+        return this->winning_status_;
+    }
+
+    // (y, x)에 현재 플레이어의 돌이 있으면 1, 상대방의 돌이 있으면 2, 비어 있으면 0을 돌려준다.
+    int getCell(const int y, const int x) const
+    {
+        int index = x * HORIZONTAL_SHIFT + y;
+        if (((this->my_board_ >> index) & 1) != 0)
+        {
+            return 1;
+        }
+        if ((((this->all_board_ ^ this->my_board_) >> index) & 1) != 0)
+        {
+            return 2;
+        }
+        return 0;
+    }
+
+    std::string toString() const
+    {
+        std::stringstream ss("");
+        ss << "is_first:\t" << this->is_first_ << "\n";
+        for (int y = Height - 1; y >= 0; y--)
+        {
+            for (int x = 0; x < Width; x++)
+            {
+                char c = '.';
+                int cell = getCell(y, x);
+                if (cell == 1)
+                {
+                    c = (is_first_ ? 'x' : 'o');
+                }
+                else if (cell == 2)
+                {
+                    c = (is_first_ ? 'o' : 'x');
+                }
+                ss << c;
+            }
+            ss << "\n";
+        }
+
+        return ss.str();
+    }
+};
+
+// 7x6은 이전과 같이 uint64_t, 9x7은 64비트를 넘으므로 unsigned __int128을 사용한다.
+static_assert(std::is_same<BitBoardType<7, 6>, uint64_t>::value, "7x6은 uint64_t");
+static_assert(std::is_same<BitBoardType<8, 7>, uint64_t>::value, "8x7은 uint64_t");
+static_assert(std::is_same<BitBoardType<9, 7>, unsigned __int128>::value, "9x7은 unsigned __int128");
+
+using ConnectFourStateByBitSet = ConnectFourBitBoardState<W, H>;
+
+using State = ConnectFourState;
+
+// 무작위로 행동을 결정한다.
+int randomAction(const State &state)
+{
+    auto legal_actions = state.legalActions();
+    return legal_actions[mt_for_action() % (legal_actions.size())];
+}
+
+namespace montecarlo_bit
+{
+    template <class BitState>
+    int randomActionBit(const BitState &state)
+    {
+        auto legal_actions = state.legalActions();
+        return legal_actions[mt_for_action() % (legal_actions.size())];
+    }
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    template <class BitState>
+    double playout(BitState *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomActionBit(*state));
+            return 1. - playout(state);
+        }
+    }
+}
+
+namespace montecarlo
+{
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(State *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state));
+            return 1. - playout(state);
+        }
+    }
+}
+
+// 비트보드의 각 칸을 하나씩 확인해서 4개 연속인 돌이 있는지 판정한다.
+template <int Width, int Height>
+bool hasFourInARow(const int (&cells)[Height][Width], const int stone)
+{
+    static constexpr const int dy[4] = {0, 1, 1, -1}; // 가로, 세로, "／", "\"방향의 y성분
+    static constexpr const int dx[4] = {1, 0, 1, 1};  // 가로, 세로, "／", "\"방향의 x성분
+    for (int y = 0; y < Height; y++)
+        for (int x = 0; x < Width; x++)
+            for (int direction = 0; direction < 4; direction++)
+            {
+                int count = 0;
+                for (int i = 0; i < 4; i++)
+                {
+                    int ty = y + dy[direction] * i;
+                    int tx = x + dx[direction] * i;
+                    if (ty < 0 || ty >= Height || tx < 0 || tx >= Width || cells[ty][tx] != stone)
+                    {
+                        break;
+                    }
+                    ++count;
+                }
+                if (count == 4)
+                {
+                    return true;
+                }
+            }
+    return false;
+}
+
+// 무작위 대전을 game_number번 진행하면서 비트보드의 합법 수와 승패 판정이 칸 단위 판정과 일치하는지 확인한다.
+template <int Width, int Height>
+void testBitBoardConsistency(const int game_number)
+{
+    using std::cout;
+    using std::endl;
+    using BitState = ConnectFourBitBoardState<Width, Height>;
+
+    int mismatch_count = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = BitState();
+        int heights[Width] = {};
+        while (!state.isDone())
+        {
+            auto legal_actions = state.legalActions();
+            std::vector<int> expected_actions;
+            for (int x = 0; x < Width; x++)
+            {
+                if (heights[x] < Height)
+                {
+                    expected_actions.emplace_back(x);
+                }
+            }
+            if (legal_actions != expected_actions)
+            {
+                ++mismatch_count;
+                break;
+            }
+            int action = legal_actions[mt_for_action() % legal_actions.size()];
+            state.advance(action);
+            ++heights[action];
+
+            int cells[Height][Width] = {};
+            for (int y = 0; y < Height; y++)
+                for (int x = 0; x < Width; x++)
+                {
+                    cells[y][x] = state.getCell(y, x);
+                }
+            bool is_enemy_win = hasFourInARow<Width, Height>(cells, 2); // 방금 둔 돌은 상대방 시점의 돌
+            bool is_full = true;
+            for (int x = 0; x < Width; x++)
+            {
+                is_full &= (heights[x] == Height);
+            }
+            WinningStatus expected_status = WinningStatus::NONE;
+            if (is_enemy_win)
+            {
+                expected_status = WinningStatus::LOSE;
+            }
+            else if (is_full)
+            {
+                expected_status = WinningStatus::DRAW;
+            }
+            if (state.getWinningStatus() != expected_status)
+            {
+                ++mismatch_count;
+                break;
+            }
+        }
+    }
+    cout << Width << "x" << Height << " (" << sizeof(typename BitState::Board) * 8 << "bit) "
+         << "mismatch " << mismatch_count << " / " << game_number << " games" << endl;
+}
+
+// ConnectFourState에서 변환한 비트보드가 같은 게임판을 나타내는지 확인한다.
+void testConversionFromConnectFourState(const int game_number)
+{
+    using std::cout;
+    using std::endl;
+    int mismatch_count = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto state = State();
+        while (!state.isDone())
+        {
+            auto bit_state = ConnectFourStateByBitSet(state);
+            if (bit_state.toString() != state.toString() || bit_state.legalActions() != state.legalActions())
+            {
+                ++mismatch_count;
+                break;
+            }
+            state.advance(randomAction(state));
+        }
+    }
+    cout << "ConnectFourState -> ConnectFourStateByBitSet mismatch " << mismatch_count << " / " << game_number << " games" << endl;
+}
+
+// 제한 시간(밀리초) 동안 초기 게임판에서 플레이아웃을 반복하고 횟수를 표시한다.
+template <class PlayoutState, class PlayoutFunction>
+void testPlayoutSpeed(const std::string &name, const PlayoutFunction &playout, const int64_t time_threshold)
+{
+    using std::cout;
+    using std::endl;
+    auto time_keeper = TimeKeeper(time_threshold);
+    int playout_count = 0;
+    while (!time_keeper.isTimeOver())
+    {
+        PlayoutState state = PlayoutState();
+        playout(&state);
+        ++playout_count;
+    }
+    cout << name << ":\t" << playout_count << " playouts in " << time_threshold << " ms" << endl;
+}
+
+int main()
+{
+    testConversionFromConnectFourState(1000);
+    testBitBoardConsistency<7, 6>(1000);
+    testBitBoardConsistency<8, 7>(1000);
+    testBitBoardConsistency<9, 7>(1000);
+
+    testPlayoutSpeed<State>("ConnectFourState 7x6", montecarlo::playout, 1000);
+    testPlayoutSpeed<ConnectFourBitBoardState<7, 6>>("ConnectFourBitBoardState<7, 6>", montecarlo_bit::playout<ConnectFourBitBoardState<7, 6>>, 1000);
+    testPlayoutSpeed<ConnectFourBitBoardState<8, 7>>("ConnectFourBitBoardState<8, 7>", montecarlo_bit::playout<ConnectFourBitBoardState<8, 7>>, 1000);
+    testPlayoutSpeed<ConnectFourBitBoardState<9, 7>>("ConnectFourBitBoardState<9, 7>", montecarlo_bit::playout<ConnectFourBitBoardState<9, 7>>, 1000);
+
+    return 0;
+}
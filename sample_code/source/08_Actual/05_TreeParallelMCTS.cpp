@@ -0,0 +1,1403 @@
+// Copyright [2022] <Copyright Eita Aoki (Thunder) >
+#include <string>
+#include <array>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <random>
+#include <assert.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+#include <queue>
+#include <set>
+#include <thread>
+#include <limits>
+#include <atomic>
+#include <memory>
+#pragma GCC diagnostic ignored "-Wsign-compare"
+std::random_device rnd;
+std::mt19937 mt_for_action(0);
+
+// 시간을 관리하는 클래스
+class TimeKeeper
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_time_;
+    int64_t time_threshold_;
+
+public:
+    // 시간 제한을 밀리초 단위로 지정해서 인스턴스를 생성한다.
+    TimeKeeper(const int64_t &time_threshold)
+        : start_time_(std::chrono::high_resolution_clock::now()),
+          time_threshold_(time_threshold)
+    {
+    }
+
+    // 인스턴스를 생성한 시점부터 지정한 시간 제한을 초과하지 않았는지 판정한다.
+    bool isTimeOver() const
+    {
+        auto diff = std::chrono::high_resolution_clock::now() - this->start_time_;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count() >= time_threshold_;
+    }
+};
+
+constexpr const int H = 6; // 미로의 높이
+constexpr const int W = 7; // 미로의 너비
+
+using ScoreType = int64_t;
+constexpr const ScoreType INF = 1000000000LL;
+
+enum WinningStatus
+{
+    WIN,
+    LOSE,
+    DRAW,
+    NONE,
+};
+
+class ConnectFourState
+{
+private:
+    static constexpr const int dx[2] = {1, -1};          // 이동 방향의 x성분
+    static constexpr const int dy_right_up[2] = {1, -1}; // /"／"대각선 방향의 x성분
+    static constexpr const int dy_left_up[2] = {-1, 1};  // "\"대각선 방향의 x성분
+    static constexpr const int dy[4] = {0, 0, 1, -1};    // 오른쪽, 왼쪽, 위쪽, 아래쪽 이동 방향의 y성분
+
+    WinningStatus winning_status_ = WinningStatus::NONE;
+
+public:
+    bool is_first_ = true; // 선공 여부
+    int my_board_[H][W] = {};
+    int enemy_board_[H][W] = {};
+
+    ConnectFourState()
+    {
+    }
+
+    // [모든 게임에서 구현] : 게임 종료 판정
+    bool isDone() const
+    {
+        return winning_status_ != WinningStatus::NONE;
+    }
+
+    // [모든 게임에서 구현] : 지정한 action으로 게임을 1턴 진행하고 다음 플레이어 시점의 게임판으로 만든다.
+    void advance(const int action)
+    {
+        std::pair<int, int> coordinate;
+        for (int y = 0; y < H; y++)
+        {
+            if (this->my_board_[y][action] == 0 && this->enemy_board_[y][action] == 0)
+            {
+                this->my_board_[y][action] = 1;
+                coordinate = std::pair<int, int>(y, action);
+                break;
+            }
+        }
+
+        { // 가로 방향으로 연속인가 판정한다.
+
+            auto que = std::deque<std::pair<int, int>>();
+            que.emplace_back(coordinate);
+            std::vector<std::vector<bool>> check(H, std::vector<bool>(W, false));
+            int count = 0;
+            while (!que.empty())
+            {
+                const auto &tmp_cod = que.front();
+                que.pop_front();
+                ++count;
+                if (count >= 4)
+                {
+                    this->winning_status_ = WinningStatus::LOSE; // 자신의 돌이 연속이면 상대방의 패배
+                    break;
+                }
+                check[tmp_cod.first][tmp_cod.second] = true;
+
+                for (int action = 0; action < 2; action++)
+                {
+                    int ty = tmp_cod.first;
+                    int tx = tmp_cod.second + dx[action];
+
+                    if (ty >= 0 && ty < H && tx >= 0 && tx < W && my_board_[ty][tx] == 1 && !check[ty][tx])
+                    {
+                        que.emplace_back(ty, tx);
+                    }
+                }
+            }
+        }
+        if (!isDone())
+        { // "／"방향으로 연속인가 판정한다.
+            auto que = std::deque<std::pair<int, int>>();
+            que.emplace_back(coordinate);
+            std::vector<std::vector<bool>> check(H, std::vector<bool>(W, false));
+            int count = 0;
+            while (!que.empty())
+            {
+                const auto &tmp_cod = que.front();
+                que.pop_front();
+                ++count;
+                if (count >= 4)
+                {
+                    this->winning_status_ = WinningStatus::LOSE; // 자신의 돌이 연속이면 상대방의 패배
+                    break;
+                }
+                check[tmp_cod.first][tmp_cod.second] = true;
+
+                for (int action = 0; action < 2; action++)
+                {
+                    int ty = tmp_cod.first + dy_right_up[action];
+                    int tx = tmp_cod.second + dx[action];
+
+                    if (ty >= 0 && ty < H && tx >= 0 && tx < W && my_board_[ty][tx] == 1 && !check[ty][tx])
+                    {
+                        que.emplace_back(ty, tx);
+                    }
+                }
+            }
+        }
+
+        if (!isDone())
+        { // "\"방향으로 연속인가 판정한다.
+
+            auto que = std::deque<std::pair<int, int>>();
+            que.emplace_back(coordinate);
+            std::vector<std::vector<bool>> check(H, std::vector<bool>(W, false));
+            int count = 0;
+            while (!que.empty())
+            {
+                const auto &tmp_cod = que.front();
+                que.pop_front();
+                ++count;
+                if (count >= 4)
+                {
+                    this->winning_status_ = WinningStatus::LOSE; // 자신의 돌이 연속이면 상대방의 패배
+                    break;
+                }
+                check[tmp_cod.first][tmp_cod.second] = true;
+
+                for (int action = 0; action < 2; action++)
+                {
+                    int ty = tmp_cod.first + dy_left_up[action];
+                    int tx = tmp_cod.second + dx[action];
+
+                    if (ty >= 0 && ty < H && tx >= 0 && tx < W && my_board_[ty][tx] == 1 && !check[ty][tx])
+                    {
+                        que.emplace_back(ty, tx);
+                    }
+                }
+            }
+        }
+        if (!isDone())
+        { // 세로 방향으로 연속인가 판정한다.
+
+            int ty = coordinate.first;
+            int tx = coordinate.second;
+            bool is_win = true;
+            for (int i = 0; i < 4; i++)
+            {
+                bool is_mine = (ty >= 0 && ty < H && tx >= 0 && tx < W && my_board_[ty][tx] == 1);
+
+                if (!is_mine)
+                {
+                    is_win = false;
+                    break;
+                }
+                --ty;
+            }
+            if (is_win)
+            {
+                this->winning_status_ = WinningStatus::LOSE; // 자신의 돌이 연속이면 상대방의 패배
+            }
+        }
+
+        std::swap(my_board_, enemy_board_);
+        is_first_ = !is_first_;
+        if (this->winning_status_ == WinningStatus::NONE && legalActions().size() == 0)
+        {
+            this->winning_status_ = WinningStatus::DRAW;
+        }
+    }
+
+    // [모든 게임에서 구현] : 현재 플레이어가 가능한 행동을 모두 획득한다.
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        for (int x = 0; x < W; x++)
+            for (int y = H - 1; y >= 0; y--)
+            {
+                if (my_board_[y][x] == 0 && enemy_board_[y][x] == 0)
+                {
+                    actions.emplace_back(x);
+                    break;
+                }
+            }
+        return actions;
+    }
+
+    // [모든 게임에서 구현] : 승패 정보를 획득한다.
+    WinningStatus getWinningStatus() const
+    {
+        return this->winning_status_;
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 선공 플레이어의 승률 계산하기 위해서 승점을 계산한다.
+    double getFirstPlayerScoreForWinRate() const
+    {
+        switch (this->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            if (this->is_first_)
+            {
+                return 1.;
+            }
+            else
+            {
+                return 0.;
+            }
+        case (WinningStatus::LOSE):
+            if (this->is_first_)
+            {
+                return 0.;
+            }
+            else
+            {
+                return 1.;
+            }
+        default:
+            return 0.5;
+        }
+    }
+
+    // [필수는 아니지만 구현하면 편리] : 현재 게임 상황을 문자열로 만든다.
+    std::string toString() const
+    {
+        std::stringstream ss("");
+
+        ss << "is_first:\t" << this->is_first_ << "\n";
+        for (int y = H - 1; y >= 0; y--)
+        {
+            for (int x = 0; x < W; x++)
+            {
+                char c = '.';
+                if (my_board_[y][x] == 1)
+                {
+                    c = (is_first_ ? 'x' : 'o');
+                }
+                else if (enemy_board_[y][x] == 1)
+                {
+                    c = (is_first_ ? 'o' : 'x');
+                }
+                ss << c;
+            }
+            ss << "\n";
+        }
+
+        return ss.str();
+    }
+};
+
+class ConnectFourStateByBitSet
+{
+private:
+    uint64_t my_board_ = 0ULL;
+    uint64_t all_board_ = 0uLL;
+    bool is_first_ = true; // 선공 여부
+    WinningStatus winning_status_ = WinningStatus::NONE;
+
+    bool isWinner(const uint64_t board)
+    {
+        // 가로 방향으로 연속인가 판정한다.
+        uint64_t tmp_board = board & (board >> 7);
+        if ((tmp_board & (tmp_board >> 14)) != 0)
+        {
+            return true;
+        }
+        // "\"방향으로 연속인가 판정한다.
+        tmp_board = board & (board >> 6);
+        if ((tmp_board & (tmp_board >> 12)) != 0)
+        {
+            return true;
+        }
+        // "／"방향으로 연속인가 판정한다.
+        tmp_board = board & (board >> 8);
+        if ((tmp_board & (tmp_board >> 16)) != 0)
+        {
+            return true;
+        }
+        // 세로 방향으로 연속인가 판정한다.
+        tmp_board = board & (board >> 1);
+        if ((tmp_board & (tmp_board >> 2)) != 0)
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+public:
+    ConnectFourStateByBitSet() {}
+    ConnectFourStateByBitSet(const ConnectFourState &state) : is_first_(state.is_first_)
+    {
+
+        my_board_ = 0ULL;
+        all_board_ = 0uLL;
+        for (int y = 0; y < H; y++)
+        {
+            for (int x = 0; x < W; x++)
+            {
+                int index = x * (H + 1) + y;
+                if (state.my_board_[y][x] == 1)
+                {
+                    this->my_board_ |= 1ULL << index;
+                }
+                if (state.my_board_[y][x] == 1 || state.enemy_board_[y][x] == 1)
+                {
+                    this->all_board_ |= 1ULL << index;
+                }
+            }
+        }
+    }
+    bool isDone() const
+    {
+        return winning_status_ != WinningStatus::NONE;
+    }
+
+    void advance(const int action)
+    {
+        this->my_board_ ^= this->all_board_; // 상대방의 시점으로 바뀐다
+        is_first_ = !is_first_;
+        uint64_t new_all_board = this->all_board_ | (this->all_board_ + (1ULL << (action * 7)));
+        this->all_board_ = new_all_board;
+        uint64_t filled = 0b0111111011111101111110111111011111101111110111111ULL;
+
+        if (isWinner(this->my_board_ ^ this->all_board_))
+        {
+            this->winning_status_ = WinningStatus::LOSE;
+        }
+        else if (this->all_board_ == filled)
+        {
+            this->winning_status_ = WinningStatus::DRAW;
+        }
+    }
+    std::vector<int> legalActions() const
+    {
+        std::vector<int> actions;
+        uint64_t possible = this->all_board_ + 0b0000001000000100000010000001000000100000010000001ULL;
+        uint64_t filter = 0b0111111;
+        for (int x = 0; x < W; x++)
+        {
+            if ((filter & possible) != 0)
+            {
+                actions.emplace_back(x);
+            }
+            filter <<= 7;
+        }
+        return actions;
+    }
+
+    WinningStatus getWinningStatus() const
+    {
+        return this->winning_status_;
+    }
+
+    std::string toString() const
+    {
+        std::stringstream ss("");
+        ss << "is_first:\t" << this->is_first_ << "\n";
+        for (int y = H - 1; y >= 0; y--)
+        {
+            for (int x = 0; x < W; x++)
+            {
+                int index = x * (H + 1) + y;
+                char c = '.';
+                if (((my_board_ >> index) & 1ULL) != 0)
+                {
+                    c = (is_first_ ? 'x' : 'o');
+                }
+                else if ((((all_board_ ^ my_board_) >> index) & 1ULL) != 0)
+                {
+                    c = (is_first_ ? 'o' : 'x');
+                }
+                ss << c;
+            }
+            ss << "\n";
+        }
+
+        return ss.str();
+    }
+};
+
+using State = ConnectFourState;
+
+using AIFunction = std::function<int(const State &)>;
+using StringAIPair = std::pair<std::string, AIFunction>;
+
+// 무작위로 행동을 결정한다.
+int randomAction(const State &state)
+{
+    auto legal_actions = state.legalActions();
+    return legal_actions[mt_for_action() % (legal_actions.size())];
+}
+
+namespace montecarlo
+{
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(State *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomAction(*state));
+            return 1. - playout(state);
+        }
+    }
+
+    constexpr const double C = 1.;             // UCB1 계산에 사용하는 상수
+    constexpr const int EXPAND_THRESHOLD = 10; // 노드를 확장하는 임계치
+
+    // MCTS 계산에 사용하는 노드
+    class Node
+    {
+    private:
+        State state_;
+        double w_;
+
+    public:
+        std::vector<Node> child_nodes_;
+        double n_;
+
+        Node(const State &state) : state_(state), w_(0), n_(0) {}
+
+        // 노드를 평가한다.
+        double evaluate()
+        {
+            if (this->state_.isDone())
+            {
+                double value = 0.5;
+                switch (this->state_.getWinningStatus())
+                {
+                case (WinningStatus::WIN):
+                    value = 1.;
+                    break;
+                case (WinningStatus::LOSE):
+                    value = 0.;
+                    break;
+                default:
+                    break;
+                }
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+            if (this->child_nodes_.empty())
+            {
+                State state_copy = this->state_;
+                double value = playout(&state_copy);
+                this->w_ += value;
+                ++this->n_;
+
+                if (this->n_ == EXPAND_THRESHOLD)
+                    this->expand();
+
+                return value;
+            }
+            else
+            {
+                double value = 1. - this->nextChildNode().evaluate();
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+        }
+
+        // 노드를 확장한다.
+        void expand()
+        {
+            auto legal_actions = this->state_.legalActions();
+            this->child_nodes_.clear();
+            for (const auto action : legal_actions)
+            {
+                this->child_nodes_.emplace_back(this->state_);
+                this->child_nodes_.back().state_.advance(action);
+            }
+        }
+
+        // 어떤 노드를 평가할지 선택한다.
+        Node &nextChildNode()
+        {
+            for (auto &child_node : this->child_nodes_)
+            {
+                if (child_node.n_ == 0)
+                    return child_node;
+            }
+            double t = 0;
+            for (const auto &child_node : this->child_nodes_)
+            {
+                t += child_node.n_;
+            }
+            double best_value = -INF;
+            int best_action_index = -1;
+            for (int i = 0; i < this->child_nodes_.size(); i++)
+            {
+                const auto &child_node = this->child_nodes_[i];
+                double ucb1_value = 1. - child_node.w_ / child_node.n_ + (double)C * std::sqrt(2. * std::log(t) / child_node.n_);
+                if (ucb1_value > best_value)
+                {
+                    best_action_index = i;
+                    best_value = ucb1_value;
+                }
+            }
+            return this->child_nodes_[best_action_index];
+        }
+    };
+
+    // 제한 시간(밀리초)을 지정해서 MCTS로 행동을 결정한다.
+    int mctsActionWithTimeThreshold(const State &state, const int64_t time_threshold)
+    {
+        Node root_node = Node(state);
+        root_node.expand();
+        auto time_keeper = TimeKeeper(time_threshold);
+        for (int cnt = 0;; cnt++)
+        {
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes_.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes_[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+}
+
+using montecarlo::mctsActionWithTimeThreshold;
+
+namespace montecarlo_bit
+{
+    int randomActionBit(const ConnectFourStateByBitSet &state)
+    {
+        auto legal_actions = state.legalActions();
+        return legal_actions[mt_for_action() % (legal_actions.size())];
+    }
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(ConnectFourStateByBitSet *state)
+    { // const&를 사용하면 재귀중에 깊은 복사가 필요하므로, 속도를 위해 포인터를 사용한다.(const가 아닌 참조도 가능)
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomActionBit(*state));
+            return 1. - playout(state);
+        }
+    }
+
+    constexpr const double C = 1.;             // UCB1 계산에 사용하는 상수
+    constexpr const int EXPAND_THRESHOLD = 10; // 노드를 확장하는 임계치
+
+    // MCTS 계산에 사용하는 노드
+    class Node
+    {
+    private:
+        ConnectFourStateByBitSet state_;
+        double w_;
+
+    public:
+        std::vector<Node> child_nodes_;
+        double n_;
+
+        Node(const ConnectFourStateByBitSet &state) : state_(state), w_(0), n_(0) {}
+
+        // 노드를 평가한다.
+        double evaluate()
+        {
+            if (this->state_.isDone())
+            {
+                double value = 0.5;
+                switch (this->state_.getWinningStatus())
+                {
+                case (WinningStatus::WIN):
+                    value = 1.;
+                    break;
+                case (WinningStatus::LOSE):
+                    value = 0.;
+                    break;
+                default:
+                    break;
+                }
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+            if (this->child_nodes_.empty())
+            {
+                ConnectFourStateByBitSet state_copy = this->state_;
+                double value = playout(&state_copy);
+                this->w_ += value;
+                ++this->n_;
+
+                if (this->n_ == EXPAND_THRESHOLD)
+                    this->expand();
+
+                return value;
+            }
+            else
+            {
+                double value = 1. - this->nextChildNode().evaluate();
+                this->w_ += value;
+                ++this->n_;
+                return value;
+            }
+        }
+
+        // 노드를 확장한다.
+        void expand()
+        {
+            auto legal_actions = this->state_.legalActions();
+            this->child_nodes_.clear();
+            for (const auto action : legal_actions)
+            {
+                this->child_nodes_.emplace_back(this->state_);
+                this->child_nodes_.back().state_.advance(action);
+            }
+        }
+
+        // 어떤 노드를 평가할지 선택한다.
+        Node &nextChildNode()
+        {
+            for (auto &child_node : this->child_nodes_)
+            {
+                if (child_node.n_ == 0)
+                    return child_node;
+            }
+            double t = 0;
+            for (const auto &child_node : this->child_nodes_)
+            {
+                t += child_node.n_;
+            }
+            double best_value = -INF;
+            int best_action_index = -1;
+            for (int i = 0; i < this->child_nodes_.size(); i++)
+            {
+                const auto &child_node = this->child_nodes_[i];
+                double ucb1_value = 1. - child_node.w_ / child_node.n_ + (double)C * std::sqrt(2. * std::log(t) / child_node.n_);
+                if (ucb1_value > best_value)
+                {
+                    best_action_index = i;
+                    best_value = ucb1_value;
+                }
+            }
+            return this->child_nodes_[best_action_index];
+        }
+    };
+
+    // 제한 시간(밀리초)을 지정해서 MCTS로 행동을 결정한다.
+    int mctsActionBitWithTimeThreshold(const State &state, const int64_t time_threshold)
+    {
+        Node root_node = Node(ConnectFourStateByBitSet(state));
+        root_node.expand();
+        auto time_keeper = TimeKeeper(time_threshold);
+        for (int cnt = 0;; cnt++)
+        {
+            if (time_keeper.isTimeOver())
+            {
+                break;
+            }
+            root_node.evaluate();
+        }
+        auto legal_actions = state.legalActions();
+
+        int best_action_searched_number = -1;
+        int best_action_index = -1;
+        assert(legal_actions.size() == root_node.child_nodes_.size());
+        for (int i = 0; i < legal_actions.size(); i++)
+        {
+            int n = root_node.child_nodes_[i].n_;
+            if (n > best_action_searched_number)
+            {
+                best_action_index = i;
+                best_action_searched_number = n;
+            }
+        }
+        return legal_actions[best_action_index];
+    }
+}
+using montecarlo_bit::mctsActionBitWithTimeThreshold;
+
+// 탐색 트리의 모든 노드를 하나의 배열 묶음에 모아서 인덱스로 관리한다.
+// 노드별 통계값은 항목별 배열(SoA)로 나누어 두고, 자식 노드는 연속된 인덱스에 배치한다.
+// 자식 노드를 선택할 때는 연속된 n_, w_ 구간만 읽으므로 힙에 흩어진 노드를 따라가지 않는다.
+template <class NodeState>
+class NodeArena
+{
+public:
+    std::vector<NodeState> states_; // 노드의 게임판
+    std::vector<int> n_;            // 시행 횟수
+    std::vector<float> w_;          // 누적 가치
+    std::vector<int> first_child_;  // 첫 번째 자식 노드의 인덱스(미확장이면 -1)
+    std::vector<int> child_count_;  // 자식 노드 수
+
+    NodeArena(const NodeState &state, const int reserve_size = 1 << 12)
+    {
+        this->states_.reserve(reserve_size);
+        this->n_.reserve(reserve_size);
+        this->w_.reserve(reserve_size);
+        this->first_child_.reserve(reserve_size);
+        this->child_count_.reserve(reserve_size);
+        this->addNode(state);
+    }
+
+    int size() const
+    {
+        return this->n_.size();
+    }
+
+    // 노드를 추가하고 인덱스를 돌려준다.
+    int addNode(const NodeState &state)
+    {
+        this->states_.emplace_back(state);
+        this->n_.emplace_back(0);
+        this->w_.emplace_back(0.f);
+        this->first_child_.emplace_back(-1);
+        this->child_count_.emplace_back(0);
+        return this->size() - 1;
+    }
+
+    // 노드를 확장한다. 자식 노드는 배열 끝에 연속으로 추가된다.
+    void expand(const int node)
+    {
+        auto legal_actions = this->states_[node].legalActions();
+        if (this->states_.capacity() < this->size() + legal_actions.size())
+        { // 부모 노드의 게임판을 참조하는 동안 재할당이 일어나지 않도록 미리 늘려둔다.
+            this->states_.reserve(2 * (this->size() + legal_actions.size()));
+        }
+        const int first_child = this->size();
+        for (const auto action : legal_actions)
+        {
+            this->addNode(this->states_[node]);
+            this->states_.back().advance(action);
+        }
+        this->first_child_[node] = first_child;
+        this->child_count_[node] = legal_actions.size();
+    }
+
+    // 노드에 평가 결과를 반영한다.
+    void update(const int node, const double value)
+    {
+        this->w_[node] += value;
+        ++this->n_[node];
+    }
+
+    // 가장 많이 시행한 자식 노드가 몇 번째 자식인지 돌려준다.
+    int mostVisitedChildOrder(const int node) const
+    {
+        const int first_child = this->first_child_[node];
+        int best_searched_number = -1;
+        int best_order = -1;
+        for (int i = 0; i < this->child_count_[node]; i++)
+        {
+            int n = this->n_[first_child + i];
+            if (n > best_searched_number)
+            {
+                best_order = i;
+                best_searched_number = n;
+            }
+        }
+        return best_order;
+    }
+};
+
+// 게임 종료시의 가치를 계산한다.
+template <class NodeState>
+double terminalValue(const NodeState &state)
+{
+    switch (state.getWinningStatus())
+    {
+    case (WinningStatus::WIN):
+        return 1.;
+    case (WinningStatus::LOSE):
+        return 0.;
+    default:
+        return 0.5;
+    }
+}
+
+namespace arena_montecarlo_bit
+{
+    using montecarlo_bit::C;
+    using montecarlo_bit::EXPAND_THRESHOLD;
+    using montecarlo_bit::playout;
+
+    // 어떤 노드를 평가할지 선택한다.
+    int nextChildNode(const NodeArena<ConnectFourStateByBitSet> &arena, const int node)
+    {
+        const int first_child = arena.first_child_[node];
+        const int last_child = first_child + arena.child_count_[node];
+        const int *n = arena.n_.data();
+        const float *w = arena.w_.data();
+        int t = 0;
+        for (int i = first_child; i < last_child; i++)
+        {
+            if (n[i] == 0)
+                return i;
+            t += n[i];
+        }
+        const double log_t = std::log((double)t);
+        double best_value = -INF;
+        int best_node = -1;
+        for (int i = first_child; i < last_child; i++)
+        {
+            double ucb1_value = 1. - w[i] / n[i] + C * std::sqrt(2. * log_t / n[i]);
+            if (ucb1_value > best_value)
+            {
+                best_node = i;
+                best_value = ucb1_value;
+            }
+        }
+        return best_node;
+    }
+
+    // 노드를 평가한다.
+    double evaluate(NodeArena<ConnectFourStateByBitSet> &arena, const int node)
+    {
+        if (arena.states_[node].isDone())
+        {
+            double value = terminalValue(arena.states_[node]);
+            arena.update(node, value);
+            return value;
+        }
+        if (arena.child_count_[node] == 0)
+        {
+            ConnectFourStateByBitSet state_copy = arena.states_[node];
+            double value = playout(&state_copy);
+            arena.update(node, value);
+
+            if (arena.n_[node] == EXPAND_THRESHOLD)
+                arena.expand(node);
+
+            return value;
+        }
+        else
+        {
+            double value = 1. - evaluate(arena, nextChildNode(arena, node));
+            arena.update(node, value);
+            return value;
+        }
+    }
+
+    // 제한 시간(밀리초)을 지정해서 노드 아레나를 사용한 MCTS로 행동을 결정한다.
+    int mctsActionBitWithTimeThreshold(const State &state, const int64_t time_threshold)
+    {
+        auto arena = NodeArena<ConnectFourStateByBitSet>(ConnectFourStateByBitSet(state));
+        arena.expand(0);
+        auto time_keeper = TimeKeeper(time_threshold);
+        while (!time_keeper.isTimeOver())
+        {
+            evaluate(arena, 0);
+        }
+        auto legal_actions = state.legalActions();
+        assert(legal_actions.size() == arena.child_count_[0]);
+        return legal_actions[arena.mostVisitedChildOrder(0)];
+    }
+}
+
+namespace fast_random
+{
+    // 시드 하나로 생성기의 내부 상태를 골고루 채우기 위해 사용한다.
+    uint64_t splitMix64(uint64_t &x)
+    {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    // xoshiro256** 난수 생성기
+    // std::mt19937과 같이 mt() 형태로 호출할 수 있다.
+    class Xoshiro256
+    {
+    private:
+        uint64_t s_[4];
+
+        static uint64_t rotl(const uint64_t x, const int k)
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+    public:
+        using result_type = uint64_t;
+
+        explicit Xoshiro256(uint64_t seed = 0)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                this->s_[i] = splitMix64(seed);
+            }
+        }
+
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+        static constexpr result_type max()
+        {
+            return UINT64_MAX;
+        }
+
+        uint64_t operator()()
+        {
+            const uint64_t result = rotl(this->s_[1] * 5, 7) * 9;
+            const uint64_t t = this->s_[1] << 17;
+            this->s_[2] ^= this->s_[0];
+            this->s_[3] ^= this->s_[1];
+            this->s_[1] ^= this->s_[2];
+            this->s_[0] ^= this->s_[3];
+            this->s_[2] ^= t;
+            this->s_[3] = rotl(this->s_[3], 45);
+            return result;
+        }
+
+        // 2^128번 생성한 것과 같은 상태로 건너뛴다. 겹치지 않는 난수열을 스레드마다 나누어 줄 때 사용한다.
+        void jump()
+        {
+            static constexpr const uint64_t JUMP[4] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+            uint64_t s[4] = {};
+            for (int i = 0; i < 4; i++)
+                for (int b = 0; b < 64; b++)
+                {
+                    if (JUMP[i] & (1ULL << b))
+                    {
+                        for (int j = 0; j < 4; j++)
+                        {
+                            s[j] ^= this->s_[j];
+                        }
+                    }
+                    (*this)();
+                }
+            for (int j = 0; j < 4; j++)
+            {
+                this->s_[j] = s[j];
+            }
+        }
+
+        // [0, n) 범위의 정수를 치우침 없이 고른다.
+        // 나머지 연산 대신 곱셈과 시프트를 사용하고, 치우침이 생기는 드문 경우에만 다시 뽑는다.
+        uint32_t nextBounded(const uint32_t n)
+        {
+            uint64_t m = ((*this)() >> 32) * n;
+            uint32_t l = (uint32_t)m;
+            if (l < n)
+            {
+                const uint32_t threshold = (0u - n) % n;
+                while (l < threshold)
+                {
+                    m = ((*this)() >> 32) * n;
+                    l = (uint32_t)m;
+                }
+            }
+            return m >> 32;
+        }
+
+        // 난수를 size개 한 번에 생성해서 out에 기록한다.
+        void fill(uint64_t *out, const int size)
+        {
+            for (int i = 0; i < size; i++)
+            {
+                out[i] = (*this)();
+            }
+        }
+    };
+
+    // seed에서 stream_id번째 스레드가 사용할 생성기를 만든다.
+    // 같은 seed와 stream_id에서는 항상 같은 난수열이 나오고, stream_id가 다르면 난수열이 겹치지 않는다.
+    Xoshiro256 makeStream(const uint64_t seed, const int stream_id)
+    {
+        auto generator = Xoshiro256(seed);
+        for (int i = 0; i < stream_id; i++)
+        {
+            generator.jump();
+        }
+        return generator;
+    }
+
+    // [0, n) 범위의 정수를 고른다.
+    template <class RandomEngine>
+    int randomIndex(RandomEngine &mt, const int n)
+    {
+        return mt() % n;
+    }
+    int randomIndex(Xoshiro256 &generator, const int n)
+    {
+        return generator.nextBounded(n);
+    }
+}
+
+namespace tree_parallel
+{
+    using montecarlo_bit::C;
+    using montecarlo_bit::EXPAND_THRESHOLD;
+    constexpr const int VIRTUAL_LOSS = 1;          // 탐색 중인 노드에 더해두는 가상 패배 횟수
+    constexpr const int NODE_CAPACITY = 1 << 20;   // 공유 트리의 노드 수 상한
+
+    // 스레드마다 독립된 난수 생성기를 사용해서 무작위로 행동을 결정한다.
+    int randomActionBit(const ConnectFourStateByBitSet &state, fast_random::Xoshiro256 &mt)
+    {
+        auto legal_actions = state.legalActions();
+        return legal_actions[fast_random::randomIndex(mt, legal_actions.size())];
+    }
+
+    // 무작위로 플레이아웃해서 승패 점수를 계산한다.
+    double playout(ConnectFourStateByBitSet *state, fast_random::Xoshiro256 &mt)
+    {
+        switch (state->getWinningStatus())
+        {
+        case (WinningStatus::WIN):
+            return 1.;
+        case (WinningStatus::LOSE):
+            return 0.;
+        case (WinningStatus::DRAW):
+            return 0.5;
+        default:
+            state->advance(randomActionBit(*state, mt));
+            return 1. - playout(state, mt);
+        }
+    }
+
+    // float 값에 원자적으로 더한다.
+    void atomicAdd(std::atomic<float> &target, const float value)
+    {
+        float expected = target.load(std::memory_order_relaxed);
+        while (!target.compare_exchange_weak(expected, expected + value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // 여러 스레드가 함께 탐색하는 트리
+    // 노드 배열은 처음에 상한만큼 확보해 두고, 노드 추가는 size_의 fetch_add로 구간을 예약해서 진행한다.
+    // 배열 확보에 시간이 걸리므로 트리는 한 번만 만들고 reset으로 다시 쓴다.
+    // 노드는 확장한 스레드가 초기화한 뒤 부모의 child_count_를 release로 기록해서 공개한다.
+    template <class NodeState>
+    class SharedTree
+    {
+    private:
+        // 모든 노드의 게임판을 해제하고 트리를 비운다.
+        void clear()
+        {
+            const int size = std::min(this->size_.load(), NODE_CAPACITY);
+            for (int i = 0; i < size; i++)
+            {
+                if (this->states_[i] != nullptr)
+                {
+                    delete this->states_[i];
+                    this->states_[i] = nullptr;
+                }
+            }
+            this->size_.store(0);
+        }
+
+    public:
+        std::unique_ptr<NodeState *[]> states_;            // 노드의 게임판(확장 이후에는 읽기만 한다)
+        std::unique_ptr<std::atomic<int>[]> n_;            // 시행 횟수
+        std::unique_ptr<std::atomic<float>[]> w_;          // 누적 가치
+        std::unique_ptr<std::atomic<int>[]> virtual_loss_; // 다른 스레드가 탐색 중인 횟수
+        std::unique_ptr<int[]> first_child_;               // 첫 번째 자식 노드의 인덱스
+        std::unique_ptr<std::atomic<int>[]> child_count_;  // 자식 노드 수(0이면 미확장)
+        std::atomic<int> size_;                            // 예약한 노드 수(줄이지 않으므로 NODE_CAPACITY를 넘을 수 있다)
+
+        SharedTree()
+            : states_(new NodeState *[NODE_CAPACITY]()),
+              n_(new std::atomic<int>[NODE_CAPACITY]),
+              w_(new std::atomic<float>[NODE_CAPACITY]),
+              virtual_loss_(new std::atomic<int>[NODE_CAPACITY]),
+              first_child_(new int[NODE_CAPACITY]),
+              child_count_(new std::atomic<int>[NODE_CAPACITY]),
+              size_(0)
+        {
+        }
+
+        ~SharedTree()
+        {
+            this->clear();
+        }
+
+        SharedTree(const SharedTree &) = delete;
+        SharedTree &operator=(const SharedTree &) = delete;
+
+        // 배열은 그대로 두고 트리를 비운 다음 state를 루트로 한다. 탐색 스레드가 없을 때만 호출한다.
+        void reset(const NodeState &state)
+        {
+            this->clear();
+            this->size_.store(1);
+            this->initNode(0, new NodeState(state));
+        }
+
+        // 노드를 초기화한다. 공개하기 전에 확장한 스레드만 호출한다.
+        void initNode(const int node, NodeState *state)
+        {
+            this->states_[node] = state;
+            this->n_[node].store(0, std::memory_order_relaxed);
+            this->w_[node].store(0.f, std::memory_order_relaxed);
+            this->virtual_loss_[node].store(0, std::memory_order_relaxed);
+            this->first_child_[node] = -1;
+            this->child_count_[node].store(0, std::memory_order_relaxed);
+        }
+
+        // 노드를 확장한다. 상한을 넘으면 확장하지 않는다.
+        // 다른 스레드가 이미 예약한 구간과 겹치지 않도록, 상한을 넘은 예약도 되돌리지 않고 트리가 가득 찬 것으로 취급한다.
+        void expand(const int node)
+        {
+            const auto &state = *this->states_[node];
+            auto legal_actions = state.legalActions();
+            const int first_child = this->size_.fetch_add(legal_actions.size());
+            if (first_child + (int)legal_actions.size() > NODE_CAPACITY)
+            {
+                return;
+            }
+            for (int i = 0; i < legal_actions.size(); i++)
+            {
+                auto child_state = new NodeState(state);
+                child_state->advance(legal_actions[i]);
+                this->initNode(first_child + i, child_state);
+            }
+            this->first_child_[node] = first_child;
+            this->child_count_[node].store(legal_actions.size(), std::memory_order_release);
+        }
+
+        // 노드에 평가 결과를 반영하고, 반영 후의 시행 횟수를 돌려준다.
+        int update(const int node, const double value)
+        {
+            atomicAdd(this->w_[node], value);
+            return this->n_[node].fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        // 가장 많이 시행한 자식 노드가 몇 번째 자식인지 돌려준다.
+        int mostVisitedChildOrder(const int node) const
+        {
+            const int first_child = this->first_child_[node];
+            int best_searched_number = -1;
+            int best_order = -1;
+            for (int i = 0; i < this->child_count_[node].load(std::memory_order_acquire); i++)
+            {
+                int n = this->n_[first_child + i].load(std::memory_order_relaxed);
+                if (n > best_searched_number)
+                {
+                    best_order = i;
+                    best_searched_number = n;
+                }
+            }
+            return best_order;
+        }
+    };
+
+    // 어떤 노드를 평가할지 선택한다.
+    // 다른 스레드가 탐색 중인 자식 노드는 가상 패배만큼 가치를 낮게 보아서 같은 경로에 몰리지 않게 한다.
+    template <class NodeState>
+    int nextChildNode(const SharedTree<NodeState> &tree, const int node, const int child_count)
+    {
+        const int first_child = tree.first_child_[node];
+        const int last_child = first_child + child_count;
+        int t = 0;
+        for (int i = first_child; i < last_child; i++)
+        {
+            int n = tree.n_[i].load(std::memory_order_relaxed) + tree.virtual_loss_[i].load(std::memory_order_relaxed);
+            if (n == 0)
+                return i;
+            t += n;
+        }
+        const double log_t = std::log((double)t);
+        double best_value = -INF;
+        int best_node = -1;
+        for (int i = first_child; i < last_child; i++)
+        {
+            // 자식 노드의 승리는 부모 노드 시점의 패배이므로 가상 패배는 n과 w에 함께 더한다.
+            const int virtual_loss = tree.virtual_loss_[i].load(std::memory_order_relaxed);
+            const double n = tree.n_[i].load(std::memory_order_relaxed) + virtual_loss;
+            const double w = tree.w_[i].load(std::memory_order_relaxed) + virtual_loss;
+            double ucb1_value = 1. - w / n + C * std::sqrt(2. * log_t / n);
+            if (ucb1_value > best_value)
+            {
+                best_node = i;
+                best_value = ucb1_value;
+            }
+        }
+        return best_node;
+    }
+
+    // 노드를 평가한다.
+    double evaluate(SharedTree<ConnectFourStateByBitSet> &tree, const int node, fast_random::Xoshiro256 &mt)
+    {
+        const ConnectFourStateByBitSet &state = *tree.states_[node];
+        if (state.isDone())
+        {
+            double value = terminalValue(state);
+            tree.update(node, value);
+            return value;
+        }
+        const int child_count = tree.child_count_[node].load(std::memory_order_acquire);
+        if (child_count == 0)
+        {
+            ConnectFourStateByBitSet state_copy = state;
+            double value = playout(&state_copy, mt);
+            // 시행 횟수가 정확히 EXPAND_THRESHOLD가 된 스레드 하나만 확장한다.
+            if (tree.update(node, value) == EXPAND_THRESHOLD)
+                tree.expand(node);
+
+            return value;
+        }
+        else
+        {
+            const int child = nextChildNode(tree, node, child_count);
+            tree.virtual_loss_[child].fetch_add(VIRTUAL_LOSS, std::memory_order_relaxed);
+            double value = 1. - evaluate(tree, child, mt);
+            tree.virtual_loss_[child].fetch_sub(VIRTUAL_LOSS, std::memory_order_relaxed);
+            tree.update(node, value);
+            return value;
+        }
+    }
+
+    // 스레드 하나가 공유 트리를 탐색한다.
+    // 전체 평가 횟수가 playout_number에 도달하거나 time_keeper의 시간 제한이 지나면 종료한다.
+    void searchTree(SharedTree<ConnectFourStateByBitSet> *tree, std::atomic<int> *playout_count, const int playout_number, const TimeKeeper *time_keeper, const uint64_t base_seed, const int thread_id)
+    {
+        auto mt = fast_random::makeStream(base_seed, thread_id);
+        while (playout_count->fetch_add(1, std::memory_order_relaxed) < playout_number)
+        {
+            if (time_keeper != nullptr && time_keeper->isTimeOver())
+            {
+                break;
+            }
+            evaluate(*tree, 0, mt);
+        }
+    }
+
+    // 행동을 결정할 때마다 큰 배열을 확보하지 않도록, 호출하는 스레드마다 트리를 하나 만들어 두고 다시 쓴다.
+    SharedTree<ConnectFourStateByBitSet> &reusableTree()
+    {
+        thread_local SharedTree<ConnectFourStateByBitSet> tree;
+        return tree;
+    }
+
+    // thread_number개의 스레드가 하나의 트리를 함께 탐색해서 행동을 결정한다.
+    int searchAction(const State &state, const int playout_number, const TimeKeeper *time_keeper, const int thread_number)
+    {
+        const uint32_t base_seed = mt_for_action();
+        auto &tree = reusableTree();
+        tree.reset(ConnectFourStateByBitSet(state));
+        tree.expand(0);
+        std::atomic<int> playout_count(0);
+        std::vector<std::thread> threads;
+        for (int thread_id = 1; thread_id < thread_number; thread_id++)
+        {
+            threads.emplace_back(searchTree, &tree, &playout_count, playout_number, time_keeper, base_seed, thread_id);
+        }
+        searchTree(&tree, &playout_count, playout_number, time_keeper, base_seed, 0);
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        auto legal_actions = state.legalActions();
+        assert(legal_actions.size() == tree.child_count_[0]);
+        return legal_actions[tree.mostVisitedChildOrder(0)];
+    }
+
+    // 전체 플레이아웃 횟수를 지정해서 트리 병렬 MCTS로 행동을 결정한다.
+    int treeParallelMctsActionBit(const State &state, const int playout_number, const int thread_number)
+    {
+        return searchAction(state, playout_number, nullptr, thread_number);
+    }
+
+    // 제한 시간(밀리초)을 지정해서 트리 병렬 MCTS로 행동을 결정한다.
+    int treeParallelMctsActionBitWithTimeThreshold(const State &state, const int64_t time_threshold, const int thread_number)
+    {
+        reusableTree(); // 처음 호출할 때의 배열 확보가 제한 시간에 들어가지 않도록 시간을 재기 전에 만들어 둔다.
+        auto time_keeper = TimeKeeper(time_threshold);
+        return searchAction(state, std::numeric_limits<int>::max(), &time_keeper, thread_number);
+    }
+}
+using tree_parallel::treeParallelMctsActionBit;
+using tree_parallel::treeParallelMctsActionBitWithTimeThreshold;
+
+
+// 게임을 game_number×2(선공과 후공을 교대)횟수만큼 플레이해서 ais의 0번째에 있는 AI 승률을 표시한다.
+void testFirstPlayerWinRate(const std::array<StringAIPair, 2> &ais, const int game_number)
+{
+    using std::cout;
+    using std::endl;
+
+    double first_player_win_rate = 0;
+    for (int i = 0; i < game_number; i++)
+    {
+        auto base_state = State();
+        for (int j = 0; j < 2; j++)
+        { // 공평하게 선공과 후공을 교대함
+            auto state = base_state;
+            auto &first_ai = ais[j];
+            auto &second_ai = ais[(j + 1) % 2];
+            for (int k = 0;; k++)
+            {
+                state.advance(first_ai.second(state));
+                if (state.isDone())
+                    break;
+                state.advance(second_ai.second(state));
+                if (state.isDone())
+                    break;
+            }
+            double win_rate_point = state.getFirstPlayerScoreForWinRate();
+            if (j == 1)
+                win_rate_point = 1 - win_rate_point;
+            if (win_rate_point >= 0)
+            {
+                state.toString();
+            }
+            first_player_win_rate += win_rate_point;
+        }
+        cout << "i " << i << " w " << first_player_win_rate / ((i + 1) * 2) << endl;
+    }
+    first_player_win_rate /= (double)(game_number * 2);
+    cout << "Winning rate of " << ais[0].first << " to " << ais[1].first << ":\t" << first_player_win_rate << endl;
+}
+
+int main()
+{
+    using std::cout;
+    using std::endl;
+    // 스레드 수를 늘렸을 때 단일 스레드 MCTS에 대한 승률이 어떻게 변하는지 확인한다.
+    for (const int thread_number : {1, 2, 4, 8})
+    {
+        auto ais = std::array<StringAIPair, 2>{
+            StringAIPair("treeParallelMctsActionBitWithTimeThreshold 10ms " + std::to_string(thread_number) + " threads", [thread_number](const State &state)
+                         { return treeParallelMctsActionBitWithTimeThreshold(state, 10, thread_number); }),
+            StringAIPair("mctsActionBitWithTimeThreshold 10ms", [](const State &state)
+                         { return arena_montecarlo_bit::mctsActionBitWithTimeThreshold(state, 10); }),
+        };
+        testFirstPlayerWinRate(ais, 100);
+    }
+
+    return 0;
+}